@@ -10,8 +10,8 @@ BUILTIN_FUNCTIONS = {
     "sum": lambda args: "Builtin::sum({" + f"{', '.join(f"{arg}" for arg in args)}" + "})",
     "min": lambda args: "Builtin::min({" + f"{', '.join(f"{arg}" for arg in args)}" + "})",
     "max": lambda args: "Builtin::max({" + f"{', '.join(f"{arg}" for arg in args)}" + "})",
-    # TODO: Implement threeway comparison between objects of all types to sort containers
-    # "sorted": lambda args: f"std::sort(std::begin({args[0]}), std::end({args[0]}))",
+    # A second argument is the key function, there are no keyword arguments
+    "sorted": lambda args: f"Builtin::sorted({', '.join(args)})",
 
     # Mathematical Functions
     "abs": lambda args: "Builtin::abs({" + f"{', '.join(f"{arg}" for arg in args)}" + "})",
@@ -22,6 +22,7 @@ BUILTIN_FUNCTIONS = {
     "str": lambda args: "Builtin::str({" + f"{', '.join(f"{arg}" for arg in args)}" + "})",
     "int": lambda args: "Builtin::int({" + f"{', '.join(f"{arg}" for arg in args)}" + "})",
     "float": lambda args: "Builtin::float({" + f"{', '.join(f"{arg}" for arg in args)}" + "})",
+    "intern": lambda args: "Builtin::intern({" + f"{', '.join(f"{arg}" for arg in args)}" + "})",
 
     # Built-in types' constructors
     "tuple": lambda args: "Builtin::tuple({" + f"{', '.join(f"{arg}" for arg in args)}" + "})",
@@ -30,6 +31,57 @@ BUILTIN_FUNCTIONS = {
     "dict": lambda args: "Builtin::dict({" + f"{', '.join(f"{arg}" for arg in args)}" + "})",
 }
 
+# Methods with an identifier precomputed by the runtime (see Util/src/Object/methods.hpp)
+BUILTIN_METHODS = {
+    "append": "append",
+    "extend": "extend",
+    "insert": "insert",
+    "index": "index",
+    "slice": "slice",
+    "pop": "pop",
+    "clear": "clear",
+    "remove": "remove",
+    "sort": "sort",
+    "add": "add",
+    "has": "has",
+    "get": "get",
+    "keys": "keys",
+    "values": "values",
+    "items": "items",
+    "addElement": "addElement",
+    "union": "unionW",
+    "intersection": "intersection",
+    "difference": "difference",
+    "join": "join",
+    "split": "split",
+    "find": "find",
+    "rfind": "rfind",
+    "count": "count",
+    "replace": "replace",
+    "startswith": "startswith",
+    "endswith": "endswith",
+    "strip": "strip",
+    "upper": "upper",
+    "lower": "lower",
+    "__abs__": "abs",
+    "__len__": "len",
+    "__min__": "min",
+    "__max__": "max",
+    "__sum__": "sum",
+    "__next__": "next",
+    "__bool__": "asBoolean",
+    "__str__": "asString",
+}
+
+def translate_method(name):
+    method_id = BUILTIN_METHODS.get(name)
+
+    if method_id:
+        return f"Methods::{method_id}"
+    else:
+        # Unknown methods are interned by name at runtime
+        return f"\"{name}\""
+
 def translate_function(name, arguments):
     translator = BUILTIN_FUNCTIONS.get(name)
 
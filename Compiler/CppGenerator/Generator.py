@@ -1,6 +1,6 @@
 from ICGenerator.node import Node
 from CppGenerator.SymbolTable import SymbolTable
-from CppGenerator.BuiltInFuctions import BUILTIN_FUNCTIONS, translate_function
+from CppGenerator.BuiltInFuctions import BUILTIN_FUNCTIONS, translate_function, translate_method
 
 # C++ code-snippets factory
 # Takes a parser's AST and emits valid C++ code 
@@ -149,8 +149,31 @@ class CodeGenerator():
             self.symbol_table.add_symbol_over(node.value, symbol_type="variable")
             code_strs.append(self.emit(f"this->{node.value}", add_newline=False))
         else:
-            code_strs.append(self.visit(node.children[0]))
-            code_strs.append(self.emit(f"->Call(\"{node.value}\", ", add_newline=False))
+            code_strs.append(self.visit_receiver(node.children[0]))
+            code_strs.append(self.emit(f".Call({translate_method(node.value)}, ", add_newline=False))
+        return ''.join(code_strs)
+
+    # Whether the node names a var of its own (a variable or a member)
+    def is_variable(self, node):
+        if node.node_type == "identifier":
+            return not isinstance(node.value, bool)
+        return node.node_type == "attribute_access" and node.children[0].value == "self"
+
+    # Object a method is called on. Calls return an ObjectPtr, so any other
+    # expression is held in a var first. Subscripts by one index call through
+    # the stored element (var::Element), so mutating methods change it in place
+    def visit_receiver(self, node):
+        if self.is_variable(node):
+            return self.visit(node)
+        if node.node_type == "subscript" and node.children[1].node_type not in {"slice", "slices"}:
+            code_strs = [self.visit_receiver(node.children[0])]
+            code_strs.append(self.emit("[", add_newline=False))
+            code_strs.append(self.visit(node.children[1]))  # Index
+            code_strs.append(self.emit("]", add_newline=False))
+            return ''.join(code_strs)
+        code_strs = [self.emit("var(", add_newline=False)]
+        code_strs.append(self.visit(node))
+        code_strs.append(self.emit(")", add_newline=False))
         return ''.join(code_strs)
 
 #------------------------ IF ------------------------
@@ -193,18 +216,21 @@ class CodeGenerator():
         code_strs = []
         temp_code1 = self.visit(node.children[0])  # Left operand
         operator_node = node.children[1]
-        temp_code2 = self.visit(operator_node.children[0])  # Right operand
+        if operator_node.value in {"in", "not in"}:
+            temp_code2 = self.visit_receiver(operator_node.children[0])  # Container
+        else:
+            temp_code2 = self.visit(operator_node.children[0])  # Right operand
 
         if operator_node.value == "in":
             code_strs.append("var(")
             code_strs.append(temp_code2)
-            code_strs.append(self.emit("->Call(\"has\", {", add_newline=False))
+            code_strs.append(self.emit(".Call(Methods::has, {", add_newline=False))
             code_strs.append(temp_code1)
             code_strs.append("}))")
         elif operator_node.value == "not in":
             code_strs.append("! var(")
             code_strs.append(temp_code2)
-            code_strs.append(self.emit("->Call(\"has\", {", add_newline=False))
+            code_strs.append(self.emit(".Call(Methods::has, {", add_newline=False))
             code_strs.append(temp_code1)
             code_strs.append("}))")
         else:
@@ -246,8 +272,11 @@ class CodeGenerator():
         target = node.children[0].children[0].value  # Loop variable
         self.emit("", add_newline=False) #TODO: Improve this solution
         iterable = self.visit(node.children[1])  # Get the iterable
+        # Variables are looped over in place, so the loop notices the body changing them
+        if not self.is_variable(node.children[1]):
+            iterable = f"(var) {iterable}"
         self.emit("", add_newline=True)
-        code_strs = [self.emit(f"for (auto se_{target} : (var) {iterable})", add_newline=False)]
+        code_strs = [self.emit(f"for (auto se_{target} : {iterable})", add_newline=False)]
         code_strs.append(self.emit("{", add_newline=True))
         code_strs.append(self.visit(node.children[2]))  # Loop body
         code_strs.append(self.emit("}", add_newline=True))
@@ -384,7 +413,8 @@ class CodeGenerator():
 
     def visit_string(self, node):
         escaped_string = node.value.replace('"', '\\"')  # Escape double quotes
-        return self.emit(f"var(\"{escaped_string}\")", add_newline=False)
+        # Literals share one interned runtime string per distinct value
+        return self.emit(f"var(\"{escaped_string}\"_interned)", add_newline=False)
 
     def visit_group(self, node):
         code_strs = [self.emit("(", add_newline=False)]
@@ -411,14 +441,23 @@ class CodeGenerator():
         for i, child in enumerate(node.children):
             if child.node_type == "identifier":
                 self.symbol_table.add_symbol("se_" + child.value, symbol_type="variable")
-            code_strs.append(self.visit(child))
+            if child.node_type == "subscript":
+                code_strs.append(self.visit_subscript(child, target=True))
+            else:
+                code_strs.append(self.visit(child))
             if i < len(node.children) - 1:
                 code_strs.append(self.emit(", ", add_newline=False))
         return ''.join(code_strs)
 
-    def visit_subscript(self, node):
-        code_strs = [self.emit("var("), self.visit(node.children[0])]  # Identifier
-        code_strs.append(self.emit("->Call(\"slice\", {", add_newline=False))
+    def visit_subscript(self, node, target=False):
+        # One index reads the element, anything else is a slice
+        # TODO: Assign to elements, targets are still emitted as slices
+        if not target and node.children[1].node_type not in {"slice", "slices"}:
+            code_strs = [self.emit("var("), self.visit_receiver(node)]
+            code_strs.append(self.emit(")", add_newline=False))
+            return ''.join(code_strs)
+        code_strs = [self.emit("var("), self.visit_receiver(node.children[0])]  # Container
+        code_strs.append(self.emit(".Call(Methods::slice, {", add_newline=False))
         code_strs.append(self.visit(node.children[1]))  # Slice
         code_strs.append(self.emit("}))", add_newline=False))
         return ''.join(code_strs)
@@ -0,0 +1,90 @@
+import os
+import shutil
+import subprocess
+from concurrent.futures import ThreadPoolExecutor
+
+import pytest
+from ICGenerator.Parser import Parser
+from ICGenerator.common import error_logger
+from CppGenerator.Generator import CodeGenerator
+
+RUNTIME_DIR = os.path.join(os.path.dirname(__file__), "..", "..", "Util", "src")
+FLAGS = ["-std=c++20", "-fno-rtti", "-pthread", "-I", RUNTIME_DIR]
+
+@pytest.fixture(autouse=True)
+def clear_errors():
+    error_logger.clear_errors()
+    yield
+    error_logger.clear_errors()
+
+def generate(code):
+    ast = Parser().parse(code)
+    transpiled_code = CodeGenerator().visit(ast)
+    assert error_logger.error_count() == 0
+    return transpiled_code
+
+# Runtime objects, compiled once for every program the tests run
+@pytest.fixture(scope="module")
+def runtime(tmp_path_factory):
+    if shutil.which("g++") is None:
+        pytest.skip("g++ not found")
+    build_dir = tmp_path_factory.mktemp("runtime")
+    sources = []
+    for folder, _, files in os.walk(RUNTIME_DIR):
+        sources.extend(os.path.join(folder, name) for name in files if name.endswith(".cpp") and name != "main.cpp")
+
+    def compile_source(index):
+        target = str(build_dir / f"{index}.o")
+        subprocess.run(["g++", *FLAGS, "-c", sources[index], "-o", target], check=True)
+        return target
+
+    with ThreadPoolExecutor(max_workers=os.cpu_count()) as pool:
+        return list(pool.map(compile_source, range(len(sources))))
+
+# Build the transpiled program and run it
+def run(runtime, tmp_path, transpiled_code):
+    (tmp_path / "main.cpp").write_text(transpiled_code)
+    program = str(tmp_path / "program")
+    subprocess.run(["g++", *FLAGS, str(tmp_path / "main.cpp"), *runtime, "-o", program], check=True)
+    return subprocess.run([program], capture_output=True, text=True)
+
+# Calls return an ObjectPtr, so a call chained on another is made through a var
+def test_chained_calls(runtime, tmp_path):
+    code = 'd = {"k": [5, 6]}\ni = d.get("k").index(6)\nprint(i)\n'
+    transpiled_code = generate(code)
+    assert 'var(se_d.Call(Methods::get, {var("k"_interned)})).Call(Methods::index' in transpiled_code
+    assert run(runtime, tmp_path, transpiled_code).stdout == "1\n"
+
+def test_membership_in_call_result(runtime, tmp_path):
+    code = 'd = {"k": {1, 2}}\nif 2 in d.get("k"):\n    print("yes")\n'
+    transpiled_code = generate(code)
+    assert 'var(se_d.Call(Methods::get, {var("k"_interned)})).Call(Methods::has' in transpiled_code
+    assert run(runtime, tmp_path, transpiled_code).stdout == "yes\n"
+
+def test_subscript_of_call_result(runtime, tmp_path):
+    code = 'd = {"k": [5, 6]}\nfirst = d.get("k")[0]\nprint(first)\n'
+    transpiled_code = generate(code)
+    assert 'var(var(se_d.Call(Methods::get, {var("k"_interned)}))[var(0)])' in transpiled_code
+    assert run(runtime, tmp_path, transpiled_code).stdout == "5\n"
+
+# Mutating methods called on a subscript change the stored element, and only it
+def test_method_call_on_element(runtime, tmp_path):
+    code = ('inner = [1]\nouter = [inner, [[2]]]\nouter[0].append(5)\nouter[1][0].append(6)\n'
+            'print(outer)\nprint(inner)\n')
+    transpiled_code = generate(code)
+    assert 'se_outer[var(0)].Call(Methods::append, {var(5)})' in transpiled_code
+    assert 'se_outer[var(1)][var(0)].Call(Methods::append, {var(6)})' in transpiled_code
+    assert run(runtime, tmp_path, transpiled_code).stdout == "[[1, 5], [[2, 6]]]\n[1]\n"
+
+# Variables are looped over in place, so changing the set in the body is noticed
+def test_set_changed_during_loop(runtime, tmp_path):
+    code = 's = {1, 2, 3}\nfor x in s:\n    s.add(x + 10)\nprint(s)\n'
+    transpiled_code = generate(code)
+    assert 'for (auto se_x : se_s)' in transpiled_code
+    result = run(runtime, tmp_path, transpiled_code)
+    assert result.returncode != 0
+    assert "Set changed size during iteration" in result.stderr
+
+def test_set_unchanged_during_loop(runtime, tmp_path):
+    code = 's = {1, 2, 3}\ntotal = 0\nfor x in s:\n    total = total + x\nprint(total)\n'
+    assert run(runtime, tmp_path, generate(code)).stdout == "6\n"
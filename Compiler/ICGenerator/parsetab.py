@@ -0,0 +1,185 @@
+
+# parsetab.py
+# This file is automatically generated. Do not edit.
+# pylint: disable=W,C,R
+_tabversion = '3.10'
+
+_lr_method = 'LALR'
+
+_lr_signature = 'fileleftORleftANDleftNOTleftLESSERLESSER_EQUALGREATERGREATER_EQUALEQUALITYleftPIPEleftCARETleftAMPERSANDleftPLUSMINUSADDITION_ASSIGNMENTSUBTRACTION_ASSIGNMENTleftSTARSLASHPERCENTDOUBLE_SLASHMULTIPLICATION_ASSIGNMENTDIVISION_ASSIGNMENTMODULO_ASSIGNMENTFLOOR_DIVISION_ASSIGNMENTrightDOUBLE_STAREXPONENTIATION_ASSIGNMENTleftL_PARENTHESISL_SQBDOTrightASSIGNMENTADDITION_ASSIGNMENT AMPERSAND AND ASSIGNMENT BIN_NUMBER BREAK CARET CLASS COLON COMMA CONTINUE DEDENT DEF DEL DIVISION_ASSIGNMENT DOT DOUBLE_SLASH DOUBLE_STAR ELIF ELSE ENDMARKER EQUALITY EXPONENTIATION_ASSIGNMENT FALSE FLOOR_DIVISION_ASSIGNMENT FOR F_NUMBER GLOBAL GREATER GREATER_EQUAL HEX_NUMBER IDENTIFIER IF IN INDENT INEQUALITY IS LESSER LESSER_EQUAL L_CB L_PARENTHESIS L_SHIFT L_SQB MINUS MODULO_ASSIGNMENT MULTIPLICATION_ASSIGNMENT NEWLINE NONE NOT NUMBER OCT_NUMBER OR PASS PERCENT PIPE PLUS RETURN R_CB R_PARENTHESIS R_SHIFT R_SQB SEMICOLON SLASH STAR STRING SUBTRACTION_ASSIGNMENT TRIPLE_STRING TRUE WHILE WHITESPACEfile : statements ENDMARKER\n            | ENDMARKER\n    statements : statements statement\n                  | statements NEWLINE\n                  | statement\n    statement : compound_stmt\n                 | simple_stmts\n    simple_stmts : simple_stmts SEMICOLON simple_stmt NEWLINE\n                    | simple_stmt NEWLINE\n                    | simple_stmt\n    simple_stmt : assignment\n                   | expressions\n                   | return_stmt\n                   | PASS\n                   | del_stmt\n                   | BREAK\n                   | CONTINUE\n                   | global_stmt\n    compound_stmt : function_def\n                     | if_stmt\n                     | class_def\n                     | for_stmt\n                     | while_stmt\n    targets : targets COMMA primary\n               | primary COMMA primary\n    target_assignment_chain : target_assignment_chain targets ASSIGNMENT\n                               | target_assignment_chain primary ASSIGNMENT\n                               | targets ASSIGNMENT\n                               | primary ASSIGNMENT\n    assignment : L_PARENTHESIS primary R_PARENTHESIS ASSIGNMENT expressions\n                  | primary augmentation_assignment expressions\n                  | target_assignment_chain expressions\n    augmentation_assignment : ADDITION_ASSIGNMENT\n                               | SUBTRACTION_ASSIGNMENT\n                               | MULTIPLICATION_ASSIGNMENT\n                               | DIVISION_ASSIGNMENT\n                               | MODULO_ASSIGNMENT\n                               | EXPONENTIATION_ASSIGNMENT\n                               | FLOOR_DIVISION_ASSIGNMENT\n    return_stmt : RETURN expressions\n                   | RETURN\n    global_stmt : GLOBAL namelist\n    del_stmt : DEL namelist\n    namelist : namelist COMMA IDENTIFIER\n                | IDENTIFIER\n    block : NEWLINE INDENT statements DEDENT\n             | simple_stmts\n    class_def : CLASS IDENTIFIER L_PARENTHESIS expression R_PARENTHESIS COLON block  \n                 | CLASS IDENTIFIER L_PARENTHESIS R_PARENTHESIS COLON block\n                 | CLASS IDENTIFIER COLON block\n    function_def : DEF IDENTIFIER L_PARENTHESIS parameters R_PARENTHESIS COLON block\n                    | DEF IDENTIFIER L_PARENTHESIS R_PARENTHESIS COLON block\n    parameters : parameters COMMA parameter\n                  | parameter\n    parameter  : IDENTIFIER ASSIGNMENT expression \n                  | IDENTIFIER\n    if_stmt : IF expression COLON block elif_stmt\n               | IF expression COLON block else_block\n               | IF expression COLON block\n    elif_stmt : ELIF expression COLON block elif_stmt\n                 | ELIF expression COLON block else_block\n                 | ELIF expression COLON block\n    else_block : ELSE COLON block\n    while_stmt : WHILE expression COLON block\n    for_stmt : FOR targets IN expressions COLON block\n                  | FOR primary IN expressions COLON block\n    expressions : expressions COMMA expression\n                   | expression\n    expression : disjunction IF disjunction ELSE expression\n                  | disjunction\n    disjunction : disjunction OR conjunction\n                   | conjunction \n    conjunction : conjunction AND inversion\n                   | inversion\n    inversion : NOT inversion \n                 | comparison\n    comparison : bitwise_or compare_op_list\n                  | bitwise_or\n    compare_op_list : compare_op_list compare_op\n                       | compare_op \n    compare_op : EQUALITY bitwise_or \n                  | INEQUALITY bitwise_or \n                  | GREATER_EQUAL bitwise_or \n                  | LESSER_EQUAL bitwise_or \n                  | GREATER bitwise_or \n                  | LESSER bitwise_or \n                  | NOT IN bitwise_or \n                  | IS NOT bitwise_or \n                  | IN bitwise_or \n                  | IS bitwise_or \n    bitwise_or : bitwise_or PIPE bitwise_xor \n                  | bitwise_xor \n    bitwise_xor : bitwise_xor CARET bitwise_and \n                   | bitwise_and\n    bitwise_and : bitwise_and AMPERSAND shift_expr \n                   | shift_expr\n    shift_expr : shift_expr L_SHIFT sum\n                  | shift_expr R_SHIFT sum\n                  | sum\n    sum : sum PLUS term\n           | sum MINUS term\n           | term\n    term : term STAR factor \n            | term SLASH factor \n            | term DOUBLE_SLASH factor \n            | term PERCENT factor\n            | factor\n    factor : PLUS factor \n              | MINUS factor \n              | power\n    power : primary DOUBLE_STAR factor\n             | primary\n    primary : primary L_PARENTHESIS expressions R_PARENTHESIS\n               | primary L_PARENTHESIS R_PARENTHESIS\n               | primary L_SQB slices R_SQB\n               | primary L_SQB expression R_SQB\n               | primary DOT IDENTIFIER\n               | atomic\n    slices : slices COMMA slice\n              | slice\n    slice : expression slice\n             | COLON expression\n             | COLON slice\n             | COLON\n    atomic : IDENTIFIER\n              | TRUE\n              | FALSE\n              | NONE\n              | strings\n              | number\n              | tuple\n              | group\n              | list\n              | dict\n              | set\n    number : NUMBER\n              | F_NUMBER\n              | BIN_NUMBER\n              | HEX_NUMBER\n              | OCT_NUMBER\n    strings : STRING\n               | TRIPLE_STRING\n    list : L_SQB expressions R_SQB\n            | L_SQB R_SQB\n    tuple : L_PARENTHESIS expression COMMA expressions R_PARENTHESIS\n             | L_PARENTHESIS expression COMMA R_PARENTHESIS\n             | L_PARENTHESIS R_PARENTHESIS\n    group : L_PARENTHESIS expression R_PARENTHESIS\n    set : L_CB expressions R_CB\n    dict : L_CB kvpairs R_CB\n            | L_CB R_CB\n    kvpairs : kvpairs COMMA kvpair\n               | kvpairs COMMA\n               | kvpair\n    kvpair : expression COLON expression\n    '
+    
+_lr_action_items = {'ENDMARKER':([0,2,4,5,6,7,8,9,10,11,12,14,17,21,22,24,25,26,27,28,29,30,32,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,71,72,74,78,81,103,105,106,107,108,109,111,116,120,121,123,139,144,149,156,157,159,164,166,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,201,208,209,211,214,217,218,221,225,226,231,232,237,238,239,240,249,253,258,259,260,261,263,264,265,266,267,268,],[3,70,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,-68,-12,-112,-11,-13,-14,-15,-16,-17,-18,-41,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-3,-4,-9,-147,-112,-32,-112,-40,-43,-45,-42,-144,-151,-75,-77,-80,-108,-109,-148,-67,-31,-114,-117,-111,-143,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,-146,-59,-47,-50,-113,-115,-116,-64,-44,-87,-88,-30,-145,-57,-58,-69,-52,-49,-65,-66,-51,-63,-46,-48,-62,-60,-61,]),'DEF':([0,2,4,5,6,7,8,9,10,11,12,14,17,21,22,24,25,26,27,28,29,30,32,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,71,72,74,78,81,103,105,106,107,108,109,111,116,120,121,123,139,144,149,156,157,159,164,166,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,201,208,209,211,214,217,218,221,225,226,231,232,237,238,239,240,243,249,253,256,258,259,260,261,263,264,265,266,267,268,],[13,13,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,-68,-12,-112,-11,-13,-14,-15,-16,-17,-18,-41,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-3,-4,-9,-147,-112,-32,-112,-40,-43,-45,-42,-144,-151,-75,-77,-80,-108,-109,-148,-67,-31,-114,-117,-111,-143,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,-146,-59,-47,-50,-113,-115,-116,-64,-44,-87,-88,-30,-145,-57,-58,13,-69,-52,13,-49,-65,-66,-51,-63,-46,-48,-62,-60,-61,]),'IF':([0,2,4,5,6,7,8,9,10,11,12,14,17,21,22,24,25,26,27,28,29,30,32,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,71,72,74,77,78,81,103,105,106,107,108,109,111,116,120,121,123,139,144,149,156,157,159,164,166,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,201,208,209,211,214,217,218,221,225,226,231,232,237,238,239,240,243,249,253,256,258,259,260,261,263,264,265,266,267,268,],[16,16,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,-68,-12,-112,-11,-13,-14,-15,-16,-17,-18,-41,-118,112,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-3,-4,-9,-112,-147,-112,-32,-112,-40,-43,-45,-42,-144,-151,-75,-77,-80,-108,-109,-148,-67,-31,-114,-117,-111,-143,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,-146,-59,-47,-50,-113,-115,-116,-64,-44,-87,-88,-30,-145,-57,-58,16,-69,-52,16,-49,-65,-66,-51,-63,-46,-48,-62,-60,-61,]),'CLASS':([0,2,4,5,6,7,8,9,10,11,12,14,17,21,22,24,25,26,27,28,29,30,32,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,71,72,74,78,81,103,105,106,107,108,109,111,116,120,121,123,139,144,149,156,157,159,164,166,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,201,208,209,211,214,217,218,221,225,226,231,232,237,238,239,240,243,249,253,256,258,259,260,261,263,264,265,266,267,268,],[18,18,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,-68,-12,-112,-11,-13,-14,-15,-16,-17,-18,-41,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-3,-4,-9,-147,-112,-32,-112,-40,-43,-45,-42,-144,-151,-75,-77,-80,-108,-109,-148,-67,-31,-114,-117,-111,-143,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,-146,-59,-47,-50,-113,-115,-116,-64,-44,-87,-88,-30,-145,-57,-58,18,-69,-52,18,-49,-65,-66,-51,-63,-46,-48,-62,-60,-61,]),'FOR':([0,2,4,5,6,7,8,9,10,11,12,14,17,21,22,24,25,26,27,28,29,30,32,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,71,72,74,78,81,103,105,106,107,108,109,111,116,120,121,123,139,144,149,156,157,159,164,166,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,201,208,209,211,214,217,218,221,225,226,231,232,237,238,239,240,243,249,253,256,258,259,260,261,263,264,265,266,267,268,],[19,19,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,-68,-12,-112,-11,-13,-14,-15,-16,-17,-18,-41,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-3,-4,-9,-147,-112,-32,-112,-40,-43,-45,-42,-144,-151,-75,-77,-80,-108,-109,-148,-67,-31,-114,-117,-111,-143,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,-146,-59,-47,-50,-113,-115,-116,-64,-44,-87,-88,-30,-145,-57,-58,19,-69,-52,19,-49,-65,-66,-51,-63,-46,-48,-62,-60,-61,]),'WHILE':([0,2,4,5,6,7,8,9,10,11,12,14,17,21,22,24,25,26,27,28,29,30,32,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,71,72,74,78,81,103,105,106,107,108,109,111,116,120,121,123,139,144,149,156,157,159,164,166,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,201,208,209,211,214,217,218,221,225,226,231,232,237,238,239,240,243,249,253,256,258,259,260,261,263,264,265,266,267,268,],[23,23,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,-68,-12,-112,-11,-13,-14,-15,-16,-17,-18,-41,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-3,-4,-9,-147,-112,-32,-112,-40,-43,-45,-42,-144,-151,-75,-77,-80,-108,-109,-148,-67,-31,-114,-117,-111,-143,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,-146,-59,-47,-50,-113,-115,-116,-64,-44,-87,-88,-30,-145,-57,-58,23,-69,-52,23,-49,-65,-66,-51,-63,-46,-48,-62,-60,-61,]),'PASS':([0,2,4,5,6,7,8,9,10,11,12,14,17,21,22,24,25,26,27,28,29,30,32,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,71,72,73,74,78,81,103,105,106,107,108,109,111,116,120,121,123,139,144,149,150,152,156,157,159,164,166,167,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,201,208,209,211,214,217,218,221,225,226,231,232,236,237,238,239,240,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[26,26,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,-68,-12,-112,-11,-13,-14,-15,-16,-17,-18,-41,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-3,-4,26,-9,-147,-112,-32,-112,-40,-43,-45,-42,-144,-151,-75,-77,-80,-108,-109,-148,26,26,-67,-31,-114,-117,-111,26,-143,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,-146,-59,-47,-50,-113,-115,-116,-64,-44,-87,-88,26,-30,-145,-57,-58,26,26,26,26,-69,26,-52,26,26,26,-49,-65,-66,-51,26,-63,-46,-48,-62,-60,-61,]),'BREAK':([0,2,4,5,6,7,8,9,10,11,12,14,17,21,22,24,25,26,27,28,29,30,32,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,71,72,73,74,78,81,103,105,106,107,108,109,111,116,120,121,123,139,144,149,150,152,156,157,159,164,166,167,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,201,208,209,211,214,217,218,221,225,226,231,232,236,237,238,239,240,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[28,28,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,-68,-12,-112,-11,-13,-14,-15,-16,-17,-18,-41,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-3,-4,28,-9,-147,-112,-32,-112,-40,-43,-45,-42,-144,-151,-75,-77,-80,-108,-109,-148,28,28,-67,-31,-114,-117,-111,28,-143,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,-146,-59,-47,-50,-113,-115,-116,-64,-44,-87,-88,28,-30,-145,-57,-58,28,28,28,28,-69,28,-52,28,28,28,-49,-65,-66,-51,28,-63,-46,-48,-62,-60,-61,]),'CONTINUE':([0,2,4,5,6,7,8,9,10,11,12,14,17,21,22,24,25,26,27,28,29,30,32,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,71,72,73,74,78,81,103,105,106,107,108,109,111,116,120,121,123,139,144,149,150,152,156,157,159,164,166,167,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,201,208,209,211,214,217,218,221,225,226,231,232,236,237,238,239,240,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[29,29,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,-68,-12,-112,-11,-13,-14,-15,-16,-17,-18,-41,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-3,-4,29,-9,-147,-112,-32,-112,-40,-43,-45,-42,-144,-151,-75,-77,-80,-108,-109,-148,29,29,-67,-31,-114,-117,-111,29,-143,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,-146,-59,-47,-50,-113,-115,-116,-64,-44,-87,-88,29,-30,-145,-57,-58,29,29,29,29,-69,29,-52,29,29,29,-49,-65,-66,-51,29,-63,-46,-48,-62,-60,-61,]),'L_PARENTHESIS':([0,2,4,5,6,7,8,9,10,11,12,14,15,16,17,19,21,22,23,24,25,26,27,28,29,30,31,32,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,71,72,73,74,75,76,77,78,81,82,84,85,86,87,88,89,90,92,93,94,95,96,97,98,99,100,101,103,105,106,107,108,109,111,112,113,114,116,120,121,122,123,124,125,126,127,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,148,149,150,151,152,153,154,155,156,157,159,161,163,164,165,166,167,168,169,171,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,206,208,209,211,214,217,218,219,220,221,223,225,226,227,231,232,233,236,237,238,239,240,241,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[15,15,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,76,76,-68,76,-12,89,76,-11,-13,-14,-15,-16,-17,-18,76,76,76,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,76,-74,76,-76,-78,-92,-94,-96,-99,76,-102,76,-107,-110,-3,-4,15,-9,146,76,89,-147,89,151,89,-28,76,76,76,76,76,-29,76,76,-33,-34,-35,-36,-37,-38,-39,-32,89,-40,-43,-45,-42,-144,76,76,76,-151,-75,-77,76,-80,76,76,76,76,76,76,76,76,76,76,76,76,76,76,-108,76,76,76,76,-109,76,-148,15,76,15,76,76,89,-67,-31,-114,76,76,-117,89,-111,15,-26,-27,-143,-71,-73,-150,76,-149,76,-79,-91,-81,-82,-83,-84,-85,-86,76,-89,76,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,76,-146,-59,-47,-50,-113,-115,76,76,-116,76,-64,-44,76,-87,-88,76,15,-30,-145,-57,-58,76,15,15,15,15,-69,15,-52,15,15,15,-49,-65,-66,-51,15,-63,-46,-48,-62,-60,-61,]),'RETURN':([0,2,4,5,6,7,8,9,10,11,12,14,17,21,22,24,25,26,27,28,29,30,32,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,71,72,73,74,78,81,103,105,106,107,108,109,111,116,120,121,123,139,144,149,150,152,156,157,159,164,166,167,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,201,208,209,211,214,217,218,221,225,226,231,232,236,237,238,239,240,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[32,32,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,-68,-12,-112,-11,-13,-14,-15,-16,-17,-18,-41,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-3,-4,32,-9,-147,-112,-32,-112,-40,-43,-45,-42,-144,-151,-75,-77,-80,-108,-109,-148,32,32,-67,-31,-114,-117,-111,32,-143,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,-146,-59,-47,-50,-113,-115,-116,-64,-44,-87,-88,32,-30,-145,-57,-58,32,32,32,32,-69,32,-52,32,32,32,-49,-65,-66,-51,32,-63,-46,-48,-62,-60,-61,]),'DEL':([0,2,4,5,6,7,8,9,10,11,12,14,17,21,22,24,25,26,27,28,29,30,32,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,71,72,73,74,78,81,103,105,106,107,108,109,111,116,120,121,123,139,144,149,150,152,156,157,159,164,166,167,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,201,208,209,211,214,217,218,221,225,226,231,232,236,237,238,239,240,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[33,33,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,-68,-12,-112,-11,-13,-14,-15,-16,-17,-18,-41,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-3,-4,33,-9,-147,-112,-32,-112,-40,-43,-45,-42,-144,-151,-75,-77,-80,-108,-109,-148,33,33,-67,-31,-114,-117,-111,33,-143,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,-146,-59,-47,-50,-113,-115,-116,-64,-44,-87,-88,33,-30,-145,-57,-58,33,33,33,33,-69,33,-52,33,33,33,-49,-65,-66,-51,33,-63,-46,-48,-62,-60,-61,]),'GLOBAL':([0,2,4,5,6,7,8,9,10,11,12,14,17,21,22,24,25,26,27,28,29,30,32,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,71,72,73,74,78,81,103,105,106,107,108,109,111,116,120,121,123,139,144,149,150,152,156,157,159,164,166,167,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,201,208,209,211,214,217,218,221,225,226,231,232,236,237,238,239,240,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[34,34,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,-68,-12,-112,-11,-13,-14,-15,-16,-17,-18,-41,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-3,-4,34,-9,-147,-112,-32,-112,-40,-43,-45,-42,-144,-151,-75,-77,-80,-108,-109,-148,34,34,-67,-31,-114,-117,-111,34,-143,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,-146,-59,-47,-50,-113,-115,-116,-64,-44,-87,-88,34,-30,-145,-57,-58,34,34,34,34,-69,34,-52,34,34,34,-49,-65,-66,-51,34,-63,-46,-48,-62,-60,-61,]),'IDENTIFIER':([0,2,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,71,72,73,74,76,78,81,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,103,105,106,107,108,109,111,112,113,114,116,120,121,122,123,124,125,126,127,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,146,148,149,150,151,152,153,154,156,157,159,161,163,164,166,167,168,169,170,171,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,206,208,209,211,214,217,218,219,220,221,223,225,226,227,231,232,233,235,236,237,238,239,240,241,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[14,14,-5,-6,-7,-19,-20,-21,-22,-23,-10,75,-125,14,14,-68,82,14,-12,-112,14,-11,-13,-14,-15,-16,-17,-18,14,14,108,108,14,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,14,-74,14,-76,-78,-92,-94,-96,-99,14,-102,14,-107,-110,-3,-4,14,-9,14,-147,-112,-28,14,14,14,14,14,164,-29,14,14,-33,-34,-35,-36,-37,-38,-39,-32,-112,-40,-43,-45,-42,-144,14,14,14,-151,-75,-77,14,-80,14,14,14,14,14,14,14,14,14,14,14,14,14,14,-108,14,14,14,14,-109,202,14,-148,14,14,14,14,14,-67,-31,-114,14,14,-117,-111,14,-26,-27,226,-143,-71,-73,-150,14,-149,14,-79,-91,-81,-82,-83,-84,-85,-86,14,-89,14,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,14,-146,-59,-47,-50,-113,-115,14,14,-116,14,-64,-44,14,-87,-88,14,202,14,-30,-145,-57,-58,14,14,14,14,14,-69,14,-52,14,14,14,-49,-65,-66,-51,14,-63,-46,-48,-62,-60,-61,]),'TRUE':([0,2,4,5,6,7,8,9,10,11,12,14,15,16,17,19,21,22,23,24,25,26,27,28,29,30,31,32,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,71,72,73,74,76,78,81,85,86,87,88,89,90,92,93,94,95,96,97,98,99,100,101,103,105,106,107,108,109,111,112,113,114,116,120,121,122,123,124,125,126,127,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,148,149,150,151,152,153,154,156,157,159,161,163,164,166,167,168,169,171,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,206,208,209,211,214,217,218,219,220,221,223,225,226,227,231,232,233,236,237,238,239,240,241,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[38,38,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,38,38,-68,38,-12,-112,38,-11,-13,-14,-15,-16,-17,-18,38,38,38,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,38,-74,38,-76,-78,-92,-94,-96,-99,38,-102,38,-107,-110,-3,-4,38,-9,38,-147,-112,-28,38,38,38,38,38,-29,38,38,-33,-34,-35,-36,-37,-38,-39,-32,-112,-40,-43,-45,-42,-144,38,38,38,-151,-75,-77,38,-80,38,38,38,38,38,38,38,38,38,38,38,38,38,38,-108,38,38,38,38,-109,38,-148,38,38,38,38,38,-67,-31,-114,38,38,-117,-111,38,-26,-27,-143,-71,-73,-150,38,-149,38,-79,-91,-81,-82,-83,-84,-85,-86,38,-89,38,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,38,-146,-59,-47,-50,-113,-115,38,38,-116,38,-64,-44,38,-87,-88,38,38,-30,-145,-57,-58,38,38,38,38,38,-69,38,-52,38,38,38,-49,-65,-66,-51,38,-63,-46,-48,-62,-60,-61,]),'FALSE':([0,2,4,5,6,7,8,9,10,11,12,14,15,16,17,19,21,22,23,24,25,26,27,28,29,30,31,32,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,71,72,73,74,76,78,81,85,86,87,88,89,90,92,93,94,95,96,97,98,99,100,101,103,105,106,107,108,109,111,112,113,114,116,120,121,122,123,124,125,126,127,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,148,149,150,151,152,153,154,156,157,159,161,163,164,166,167,168,169,171,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,206,208,209,211,214,217,218,219,220,221,223,225,226,227,231,232,233,236,237,238,239,240,241,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[39,39,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,39,39,-68,39,-12,-112,39,-11,-13,-14,-15,-16,-17,-18,39,39,39,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,39,-74,39,-76,-78,-92,-94,-96,-99,39,-102,39,-107,-110,-3,-4,39,-9,39,-147,-112,-28,39,39,39,39,39,-29,39,39,-33,-34,-35,-36,-37,-38,-39,-32,-112,-40,-43,-45,-42,-144,39,39,39,-151,-75,-77,39,-80,39,39,39,39,39,39,39,39,39,39,39,39,39,39,-108,39,39,39,39,-109,39,-148,39,39,39,39,39,-67,-31,-114,39,39,-117,-111,39,-26,-27,-143,-71,-73,-150,39,-149,39,-79,-91,-81,-82,-83,-84,-85,-86,39,-89,39,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,39,-146,-59,-47,-50,-113,-115,39,39,-116,39,-64,-44,39,-87,-88,39,39,-30,-145,-57,-58,39,39,39,39,39,-69,39,-52,39,39,39,-49,-65,-66,-51,39,-63,-46,-48,-62,-60,-61,]),'NONE':([0,2,4,5,6,7,8,9,10,11,12,14,15,16,17,19,21,22,23,24,25,26,27,28,29,30,31,32,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,71,72,73,74,76,78,81,85,86,87,88,89,90,92,93,94,95,96,97,98,99,100,101,103,105,106,107,108,109,111,112,113,114,116,120,121,122,123,124,125,126,127,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,148,149,150,151,152,153,154,156,157,159,161,163,164,166,167,168,169,171,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,206,208,209,211,214,217,218,219,220,221,223,225,226,227,231,232,233,236,237,238,239,240,241,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[40,40,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,40,40,-68,40,-12,-112,40,-11,-13,-14,-15,-16,-17,-18,40,40,40,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,40,-74,40,-76,-78,-92,-94,-96,-99,40,-102,40,-107,-110,-3,-4,40,-9,40,-147,-112,-28,40,40,40,40,40,-29,40,40,-33,-34,-35,-36,-37,-38,-39,-32,-112,-40,-43,-45,-42,-144,40,40,40,-151,-75,-77,40,-80,40,40,40,40,40,40,40,40,40,40,40,40,40,40,-108,40,40,40,40,-109,40,-148,40,40,40,40,40,-67,-31,-114,40,40,-117,-111,40,-26,-27,-143,-71,-73,-150,40,-149,40,-79,-91,-81,-82,-83,-84,-85,-86,40,-89,40,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,40,-146,-59,-47,-50,-113,-115,40,40,-116,40,-64,-44,40,-87,-88,40,40,-30,-145,-57,-58,40,40,40,40,40,-69,40,-52,40,40,40,-49,-65,-66,-51,40,-63,-46,-48,-62,-60,-61,]),'STRING':([0,2,4,5,6,7,8,9,10,11,12,14,15,16,17,19,21,22,23,24,25,26,27,28,29,30,31,32,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,71,72,73,74,76,78,81,85,86,87,88,89,90,92,93,94,95,96,97,98,99,100,101,103,105,106,107,108,109,111,112,113,114,116,120,121,122,123,124,125,126,127,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,148,149,150,151,152,153,154,156,157,159,161,163,164,166,167,168,169,171,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,206,208,209,211,214,217,218,219,220,221,223,225,226,227,231,232,233,236,237,238,239,240,241,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[49,49,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,49,49,-68,49,-12,-112,49,-11,-13,-14,-15,-16,-17,-18,49,49,49,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,49,-74,49,-76,-78,-92,-94,-96,-99,49,-102,49,-107,-110,-3,-4,49,-9,49,-147,-112,-28,49,49,49,49,49,-29,49,49,-33,-34,-35,-36,-37,-38,-39,-32,-112,-40,-43,-45,-42,-144,49,49,49,-151,-75,-77,49,-80,49,49,49,49,49,49,49,49,49,49,49,49,49,49,-108,49,49,49,49,-109,49,-148,49,49,49,49,49,-67,-31,-114,49,49,-117,-111,49,-26,-27,-143,-71,-73,-150,49,-149,49,-79,-91,-81,-82,-83,-84,-85,-86,49,-89,49,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,49,-146,-59,-47,-50,-113,-115,49,49,-116,49,-64,-44,49,-87,-88,49,49,-30,-145,-57,-58,49,49,49,49,49,-69,49,-52,49,49,49,-49,-65,-66,-51,49,-63,-46,-48,-62,-60,-61,]),'TRIPLE_STRING':([0,2,4,5,6,7,8,9,10,11,12,14,15,16,17,19,21,22,23,24,25,26,27,28,29,30,31,32,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,71,72,73,74,76,78,81,85,86,87,88,89,90,92,93,94,95,96,97,98,99,100,101,103,105,106,107,108,109,111,112,113,114,116,120,121,122,123,124,125,126,127,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,148,149,150,151,152,153,154,156,157,159,161,163,164,166,167,168,169,171,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,206,208,209,211,214,217,218,219,220,221,223,225,226,227,231,232,233,236,237,238,239,240,241,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[50,50,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,50,50,-68,50,-12,-112,50,-11,-13,-14,-15,-16,-17,-18,50,50,50,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,50,-74,50,-76,-78,-92,-94,-96,-99,50,-102,50,-107,-110,-3,-4,50,-9,50,-147,-112,-28,50,50,50,50,50,-29,50,50,-33,-34,-35,-36,-37,-38,-39,-32,-112,-40,-43,-45,-42,-144,50,50,50,-151,-75,-77,50,-80,50,50,50,50,50,50,50,50,50,50,50,50,50,50,-108,50,50,50,50,-109,50,-148,50,50,50,50,50,-67,-31,-114,50,50,-117,-111,50,-26,-27,-143,-71,-73,-150,50,-149,50,-79,-91,-81,-82,-83,-84,-85,-86,50,-89,50,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,50,-146,-59,-47,-50,-113,-115,50,50,-116,50,-64,-44,50,-87,-88,50,50,-30,-145,-57,-58,50,50,50,50,50,-69,50,-52,50,50,50,-49,-65,-66,-51,50,-63,-46,-48,-62,-60,-61,]),'NUMBER':([0,2,4,5,6,7,8,9,10,11,12,14,15,16,17,19,21,22,23,24,25,26,27,28,29,30,31,32,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,71,72,73,74,76,78,81,85,86,87,88,89,90,92,93,94,95,96,97,98,99,100,101,103,105,106,107,108,109,111,112,113,114,116,120,121,122,123,124,125,126,127,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,148,149,150,151,152,153,154,156,157,159,161,163,164,166,167,168,169,171,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,206,208,209,211,214,217,218,219,220,221,223,225,226,227,231,232,233,236,237,238,239,240,241,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[51,51,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,51,51,-68,51,-12,-112,51,-11,-13,-14,-15,-16,-17,-18,51,51,51,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,51,-74,51,-76,-78,-92,-94,-96,-99,51,-102,51,-107,-110,-3,-4,51,-9,51,-147,-112,-28,51,51,51,51,51,-29,51,51,-33,-34,-35,-36,-37,-38,-39,-32,-112,-40,-43,-45,-42,-144,51,51,51,-151,-75,-77,51,-80,51,51,51,51,51,51,51,51,51,51,51,51,51,51,-108,51,51,51,51,-109,51,-148,51,51,51,51,51,-67,-31,-114,51,51,-117,-111,51,-26,-27,-143,-71,-73,-150,51,-149,51,-79,-91,-81,-82,-83,-84,-85,-86,51,-89,51,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,51,-146,-59,-47,-50,-113,-115,51,51,-116,51,-64,-44,51,-87,-88,51,51,-30,-145,-57,-58,51,51,51,51,51,-69,51,-52,51,51,51,-49,-65,-66,-51,51,-63,-46,-48,-62,-60,-61,]),'F_NUMBER':([0,2,4,5,6,7,8,9,10,11,12,14,15,16,17,19,21,22,23,24,25,26,27,28,29,30,31,32,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,71,72,73,74,76,78,81,85,86,87,88,89,90,92,93,94,95,96,97,98,99,100,101,103,105,106,107,108,109,111,112,113,114,116,120,121,122,123,124,125,126,127,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,148,149,150,151,152,153,154,156,157,159,161,163,164,166,167,168,169,171,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,206,208,209,211,214,217,218,219,220,221,223,225,226,227,231,232,233,236,237,238,239,240,241,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[52,52,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,52,52,-68,52,-12,-112,52,-11,-13,-14,-15,-16,-17,-18,52,52,52,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,52,-74,52,-76,-78,-92,-94,-96,-99,52,-102,52,-107,-110,-3,-4,52,-9,52,-147,-112,-28,52,52,52,52,52,-29,52,52,-33,-34,-35,-36,-37,-38,-39,-32,-112,-40,-43,-45,-42,-144,52,52,52,-151,-75,-77,52,-80,52,52,52,52,52,52,52,52,52,52,52,52,52,52,-108,52,52,52,52,-109,52,-148,52,52,52,52,52,-67,-31,-114,52,52,-117,-111,52,-26,-27,-143,-71,-73,-150,52,-149,52,-79,-91,-81,-82,-83,-84,-85,-86,52,-89,52,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,52,-146,-59,-47,-50,-113,-115,52,52,-116,52,-64,-44,52,-87,-88,52,52,-30,-145,-57,-58,52,52,52,52,52,-69,52,-52,52,52,52,-49,-65,-66,-51,52,-63,-46,-48,-62,-60,-61,]),'BIN_NUMBER':([0,2,4,5,6,7,8,9,10,11,12,14,15,16,17,19,21,22,23,24,25,26,27,28,29,30,31,32,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,71,72,73,74,76,78,81,85,86,87,88,89,90,92,93,94,95,96,97,98,99,100,101,103,105,106,107,108,109,111,112,113,114,116,120,121,122,123,124,125,126,127,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,148,149,150,151,152,153,154,156,157,159,161,163,164,166,167,168,169,171,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,206,208,209,211,214,217,218,219,220,221,223,225,226,227,231,232,233,236,237,238,239,240,241,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[53,53,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,53,53,-68,53,-12,-112,53,-11,-13,-14,-15,-16,-17,-18,53,53,53,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,53,-74,53,-76,-78,-92,-94,-96,-99,53,-102,53,-107,-110,-3,-4,53,-9,53,-147,-112,-28,53,53,53,53,53,-29,53,53,-33,-34,-35,-36,-37,-38,-39,-32,-112,-40,-43,-45,-42,-144,53,53,53,-151,-75,-77,53,-80,53,53,53,53,53,53,53,53,53,53,53,53,53,53,-108,53,53,53,53,-109,53,-148,53,53,53,53,53,-67,-31,-114,53,53,-117,-111,53,-26,-27,-143,-71,-73,-150,53,-149,53,-79,-91,-81,-82,-83,-84,-85,-86,53,-89,53,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,53,-146,-59,-47,-50,-113,-115,53,53,-116,53,-64,-44,53,-87,-88,53,53,-30,-145,-57,-58,53,53,53,53,53,-69,53,-52,53,53,53,-49,-65,-66,-51,53,-63,-46,-48,-62,-60,-61,]),'HEX_NUMBER':([0,2,4,5,6,7,8,9,10,11,12,14,15,16,17,19,21,22,23,24,25,26,27,28,29,30,31,32,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,71,72,73,74,76,78,81,85,86,87,88,89,90,92,93,94,95,96,97,98,99,100,101,103,105,106,107,108,109,111,112,113,114,116,120,121,122,123,124,125,126,127,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,148,149,150,151,152,153,154,156,157,159,161,163,164,166,167,168,169,171,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,206,208,209,211,214,217,218,219,220,221,223,225,226,227,231,232,233,236,237,238,239,240,241,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[54,54,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,54,54,-68,54,-12,-112,54,-11,-13,-14,-15,-16,-17,-18,54,54,54,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,54,-74,54,-76,-78,-92,-94,-96,-99,54,-102,54,-107,-110,-3,-4,54,-9,54,-147,-112,-28,54,54,54,54,54,-29,54,54,-33,-34,-35,-36,-37,-38,-39,-32,-112,-40,-43,-45,-42,-144,54,54,54,-151,-75,-77,54,-80,54,54,54,54,54,54,54,54,54,54,54,54,54,54,-108,54,54,54,54,-109,54,-148,54,54,54,54,54,-67,-31,-114,54,54,-117,-111,54,-26,-27,-143,-71,-73,-150,54,-149,54,-79,-91,-81,-82,-83,-84,-85,-86,54,-89,54,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,54,-146,-59,-47,-50,-113,-115,54,54,-116,54,-64,-44,54,-87,-88,54,54,-30,-145,-57,-58,54,54,54,54,54,-69,54,-52,54,54,54,-49,-65,-66,-51,54,-63,-46,-48,-62,-60,-61,]),'OCT_NUMBER':([0,2,4,5,6,7,8,9,10,11,12,14,15,16,17,19,21,22,23,24,25,26,27,28,29,30,31,32,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,71,72,73,74,76,78,81,85,86,87,88,89,90,92,93,94,95,96,97,98,99,100,101,103,105,106,107,108,109,111,112,113,114,116,120,121,122,123,124,125,126,127,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,148,149,150,151,152,153,154,156,157,159,161,163,164,166,167,168,169,171,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,206,208,209,211,214,217,218,219,220,221,223,225,226,227,231,232,233,236,237,238,239,240,241,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[55,55,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,55,55,-68,55,-12,-112,55,-11,-13,-14,-15,-16,-17,-18,55,55,55,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,55,-74,55,-76,-78,-92,-94,-96,-99,55,-102,55,-107,-110,-3,-4,55,-9,55,-147,-112,-28,55,55,55,55,55,-29,55,55,-33,-34,-35,-36,-37,-38,-39,-32,-112,-40,-43,-45,-42,-144,55,55,55,-151,-75,-77,55,-80,55,55,55,55,55,55,55,55,55,55,55,55,55,55,-108,55,55,55,55,-109,55,-148,55,55,55,55,55,-67,-31,-114,55,55,-117,-111,55,-26,-27,-143,-71,-73,-150,55,-149,55,-79,-91,-81,-82,-83,-84,-85,-86,55,-89,55,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,55,-146,-59,-47,-50,-113,-115,55,55,-116,55,-64,-44,55,-87,-88,55,55,-30,-145,-57,-58,55,55,55,55,55,-69,55,-52,55,55,55,-49,-65,-66,-51,55,-63,-46,-48,-62,-60,-61,]),'L_SQB':([0,2,4,5,6,7,8,9,10,11,12,14,15,16,17,19,21,22,23,24,25,26,27,28,29,30,31,32,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,71,72,73,74,76,77,78,81,84,85,86,87,88,89,90,92,93,94,95,96,97,98,99,100,101,103,105,106,107,108,109,111,112,113,114,116,120,121,122,123,124,125,126,127,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,148,149,150,151,152,153,154,155,156,157,159,161,163,164,165,166,167,168,169,171,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,206,208,209,211,214,217,218,219,220,221,223,225,226,227,231,232,233,236,237,238,239,240,241,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[35,35,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,35,35,-68,35,-12,90,35,-11,-13,-14,-15,-16,-17,-18,35,35,35,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,35,-74,35,-76,-78,-92,-94,-96,-99,35,-102,35,-107,-110,-3,-4,35,-9,35,90,-147,90,90,-28,35,35,35,35,35,-29,35,35,-33,-34,-35,-36,-37,-38,-39,-32,90,-40,-43,-45,-42,-144,35,35,35,-151,-75,-77,35,-80,35,35,35,35,35,35,35,35,35,35,35,35,35,35,-108,35,35,35,35,-109,35,-148,35,35,35,35,35,90,-67,-31,-114,35,35,-117,90,-111,35,-26,-27,-143,-71,-73,-150,35,-149,35,-79,-91,-81,-82,-83,-84,-85,-86,35,-89,35,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,35,-146,-59,-47,-50,-113,-115,35,35,-116,35,-64,-44,35,-87,-88,35,35,-30,-145,-57,-58,35,35,35,35,35,-69,35,-52,35,35,35,-49,-65,-66,-51,35,-63,-46,-48,-62,-60,-61,]),'L_CB':([0,2,4,5,6,7,8,9,10,11,12,14,15,16,17,19,21,22,23,24,25,26,27,28,29,30,31,32,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,71,72,73,74,76,78,81,85,86,87,88,89,90,92,93,94,95,96,97,98,99,100,101,103,105,106,107,108,109,111,112,113,114,116,120,121,122,123,124,125,126,127,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,148,149,150,151,152,153,154,156,157,159,161,163,164,166,167,168,169,171,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,206,208,209,211,214,217,218,219,220,221,223,225,226,227,231,232,233,236,237,238,239,240,241,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[56,56,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,56,56,-68,56,-12,-112,56,-11,-13,-14,-15,-16,-17,-18,56,56,56,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,56,-74,56,-76,-78,-92,-94,-96,-99,56,-102,56,-107,-110,-3,-4,56,-9,56,-147,-112,-28,56,56,56,56,56,-29,56,56,-33,-34,-35,-36,-37,-38,-39,-32,-112,-40,-43,-45,-42,-144,56,56,56,-151,-75,-77,56,-80,56,56,56,56,56,56,56,56,56,56,56,56,56,56,-108,56,56,56,56,-109,56,-148,56,56,56,56,56,-67,-31,-114,56,56,-117,-111,56,-26,-27,-143,-71,-73,-150,56,-149,56,-79,-91,-81,-82,-83,-84,-85,-86,56,-89,56,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,56,-146,-59,-47,-50,-113,-115,56,56,-116,56,-64,-44,56,-87,-88,56,56,-30,-145,-57,-58,56,56,56,56,56,-69,56,-52,56,56,56,-49,-65,-66,-51,56,-63,-46,-48,-62,-60,-61,]),'NOT':([0,2,4,5,6,7,8,9,10,11,12,14,15,16,17,21,22,23,24,25,26,27,28,29,30,31,32,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,66,68,69,71,72,73,74,76,77,78,81,85,87,88,89,90,92,95,96,97,98,99,100,101,103,105,106,107,108,109,111,112,113,114,116,120,121,123,132,139,144,148,149,150,151,152,153,154,156,157,159,161,163,164,166,167,168,169,171,173,174,175,176,177,178,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,201,206,208,209,211,214,217,218,219,220,221,223,225,226,227,231,232,233,236,237,238,239,240,241,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[58,58,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,58,58,-68,-12,-112,58,-11,-13,-14,-15,-16,-17,-18,58,58,58,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,58,-74,58,-76,130,-92,-94,-96,-99,-102,-107,-110,-3,-4,58,-9,58,-112,-147,-112,-28,58,58,58,58,-29,-33,-34,-35,-36,-37,-38,-39,-32,-112,-40,-43,-45,-42,-144,58,58,58,-151,-75,130,-80,189,-108,-109,58,-148,58,58,58,58,58,-67,-31,-114,58,58,-117,-111,58,-26,-27,-143,-71,-73,-150,58,-149,58,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,58,-146,-59,-47,-50,-113,-115,58,58,-116,58,-64,-44,58,-87,-88,58,58,-30,-145,-57,-58,58,58,58,58,58,-69,58,-52,58,58,58,-49,-65,-66,-51,58,-63,-46,-48,-62,-60,-61,]),'PLUS':([0,2,4,5,6,7,8,9,10,11,12,14,15,16,17,21,22,23,24,25,26,27,28,29,30,31,32,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,71,72,73,74,76,77,78,81,85,87,88,89,90,92,94,95,96,97,98,99,100,101,103,105,106,107,108,109,111,112,113,114,116,120,121,122,123,124,125,126,127,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,148,149,150,151,152,153,154,156,157,159,161,163,164,166,167,168,169,171,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,206,208,209,211,214,217,218,219,220,221,223,225,226,227,231,232,233,236,237,238,239,240,241,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[65,65,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,65,65,-68,-12,-112,65,-11,-13,-14,-15,-16,-17,-18,65,65,65,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,65,-74,65,-76,-78,-92,-94,-96,137,65,-102,65,-107,-110,-3,-4,65,-9,65,-112,-147,-112,-28,65,65,65,65,-29,65,-33,-34,-35,-36,-37,-38,-39,-32,-112,-40,-43,-45,-42,-144,65,65,65,-151,-75,-77,65,-80,65,65,65,65,65,65,65,65,65,65,65,65,65,65,-108,65,65,65,65,-109,65,-148,65,65,65,65,65,-67,-31,-114,65,65,-117,-111,65,-26,-27,-143,-71,-73,-150,65,-149,65,-79,-91,-81,-82,-83,-84,-85,-86,65,-89,65,-90,-93,-95,137,137,-100,-101,-103,-104,-105,-106,-8,65,-146,-59,-47,-50,-113,-115,65,65,-116,65,-64,-44,65,-87,-88,65,65,-30,-145,-57,-58,65,65,65,65,65,-69,65,-52,65,65,65,-49,-65,-66,-51,65,-63,-46,-48,-62,-60,-61,]),'MINUS':([0,2,4,5,6,7,8,9,10,11,12,14,15,16,17,21,22,23,24,25,26,27,28,29,30,31,32,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,71,72,73,74,76,77,78,81,85,87,88,89,90,92,94,95,96,97,98,99,100,101,103,105,106,107,108,109,111,112,113,114,116,120,121,122,123,124,125,126,127,128,129,131,132,133,134,135,136,137,138,139,140,141,142,143,144,148,149,150,151,152,153,154,156,157,159,161,163,164,166,167,168,169,171,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,206,208,209,211,214,217,218,219,220,221,223,225,226,227,231,232,233,236,237,238,239,240,241,243,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[67,67,-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,67,67,-68,-12,-112,67,-11,-13,-14,-15,-16,-17,-18,67,67,67,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,67,-74,67,-76,-78,-92,-94,-96,138,67,-102,67,-107,-110,-3,-4,67,-9,67,-112,-147,-112,-28,67,67,67,67,-29,67,-33,-34,-35,-36,-37,-38,-39,-32,-112,-40,-43,-45,-42,-144,67,67,67,-151,-75,-77,67,-80,67,67,67,67,67,67,67,67,67,67,67,67,67,67,-108,67,67,67,67,-109,67,-148,67,67,67,67,67,-67,-31,-114,67,67,-117,-111,67,-26,-27,-143,-71,-73,-150,67,-149,67,-79,-91,-81,-82,-83,-84,-85,-86,67,-89,67,-90,-93,-95,138,138,-100,-101,-103,-104,-105,-106,-8,67,-146,-59,-47,-50,-113,-115,67,67,-116,67,-64,-44,67,-87,-88,67,67,-30,-145,-57,-58,67,67,67,67,67,-69,67,-52,67,67,67,-49,-65,-66,-51,67,-63,-46,-48,-62,-60,-61,]),'$end':([1,3,70,],[0,-2,-1,]),'NEWLINE':([2,4,5,6,7,8,9,10,11,12,14,17,21,22,24,25,26,27,28,29,30,32,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,71,72,74,78,81,103,105,106,107,108,109,111,116,120,121,123,139,144,145,149,150,152,156,157,159,164,166,167,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,201,208,209,211,214,217,218,221,225,226,231,232,236,237,238,239,240,245,246,247,249,251,253,255,256,257,258,259,260,261,262,263,264,265,266,267,268,],[72,-5,-6,-7,-19,-20,-21,-22,-23,74,-125,-68,-12,-112,-11,-13,-14,-15,-16,-17,-18,-41,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-3,-4,-9,-147,-112,-32,-112,-40,-43,-45,-42,-144,-151,-75,-77,-80,-108,-109,201,-148,210,210,-67,-31,-114,-117,-111,210,-143,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,-146,-59,-47,-50,-113,-115,-116,-64,-44,-87,-88,210,-30,-145,-57,-58,210,210,210,-69,210,-52,210,72,210,-49,-65,-66,-51,210,-63,-46,-48,-62,-60,-61,]),'DEDENT':([4,5,6,7,8,9,10,11,12,14,17,21,22,24,25,26,27,28,29,30,32,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,71,72,74,78,81,103,105,106,107,108,109,111,116,120,121,123,139,144,149,156,157,159,164,166,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,201,208,209,211,214,217,218,221,225,226,231,232,237,238,239,240,249,253,256,258,259,260,261,263,264,265,266,267,268,],[-5,-6,-7,-19,-20,-21,-22,-23,-10,-125,-68,-12,-112,-11,-13,-14,-15,-16,-17,-18,-41,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-3,-4,-9,-147,-112,-32,-112,-40,-43,-45,-42,-144,-151,-75,-77,-80,-108,-109,-148,-67,-31,-114,-117,-111,-143,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,-146,-59,-47,-50,-113,-115,-116,-64,-44,-87,-88,-30,-145,-57,-58,-69,-52,264,-49,-65,-66,-51,-63,-46,-48,-62,-60,-61,]),'SEMICOLON':([6,12,14,17,21,22,24,25,26,27,28,29,30,32,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,74,78,81,103,105,106,107,108,109,111,116,120,121,123,139,144,149,156,157,159,164,166,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,201,208,211,217,218,221,226,231,232,237,238,249,],[73,-10,-125,-68,-12,-112,-11,-13,-14,-15,-16,-17,-18,-41,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-9,-147,-112,-32,-112,-40,-43,-45,-42,-144,-151,-75,-77,-80,-108,-109,-148,-67,-31,-114,-117,-111,-143,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,-146,73,-113,-115,-116,-44,-87,-88,-30,-145,-69,]),'ELIF':([12,14,17,21,22,24,25,26,27,28,29,30,32,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,74,78,81,103,105,106,107,108,109,111,116,120,121,123,139,144,149,156,157,159,164,166,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,201,208,209,211,217,218,221,226,231,232,237,238,249,264,266,],[-10,-125,-68,-12,-112,-11,-13,-14,-15,-16,-17,-18,-41,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-9,-147,-112,-32,-112,-40,-43,-45,-42,-144,-151,-75,-77,-80,-108,-109,-148,-67,-31,-114,-117,-111,-143,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,-146,241,-47,-113,-115,-116,-44,-87,-88,-30,-145,-69,-46,241,]),'ELSE':([12,14,17,21,22,24,25,26,27,28,29,30,32,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,74,78,81,103,105,106,107,108,109,111,116,120,121,123,139,144,149,156,157,159,164,166,171,172,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,201,208,209,211,217,218,221,226,231,232,237,238,249,264,266,],[-10,-125,-68,-12,-112,-11,-13,-14,-15,-16,-17,-18,-41,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-9,-147,-112,-32,-112,-40,-43,-45,-42,-144,-151,-75,-77,-80,-108,-109,-148,-67,-31,-114,-117,-111,-143,227,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-8,-146,242,-47,-113,-115,-116,-44,-87,-88,-30,-145,-69,-46,242,]),'DOT':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,77,78,81,84,105,111,116,149,155,159,164,165,171,175,177,208,217,218,221,238,],[-125,91,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,91,-147,91,91,91,-144,-151,-148,91,-114,-117,91,-143,-150,-149,-146,-113,-115,-116,-145,]),'ASSIGNMENT':([14,20,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,78,104,105,111,116,147,149,155,159,164,165,171,175,177,202,208,217,218,221,238,],[-125,85,92,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,-147,168,169,-144,-151,206,-148,-24,-114,-117,-25,-143,-150,-149,233,-146,-113,-115,-116,-145,]),'COMMA':([14,17,20,21,22,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,77,78,79,81,83,84,103,104,105,106,107,108,109,110,111,115,116,117,118,119,120,121,123,139,144,149,155,156,157,158,159,160,162,163,164,165,166,171,173,174,175,176,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,202,203,205,207,208,215,216,217,218,221,222,223,224,226,228,230,231,232,237,238,248,249,250,252,],[-125,-68,86,87,93,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-112,-147,148,-112,86,93,87,86,93,87,170,-45,170,87,-144,176,-151,87,-154,-68,-75,-77,-80,-108,-109,-148,-24,-67,87,87,-114,219,-120,-124,-117,-25,-111,-143,-71,-73,-150,-153,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-56,235,-54,87,-146,87,87,-113,-115,-116,-121,-122,-123,-44,-152,-155,-87,-88,87,-145,-119,-69,-55,-53,]),'DOUBLE_STAR':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,77,78,81,105,111,116,149,159,164,171,175,177,208,217,218,221,238,],[-125,94,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,94,-147,94,94,-144,-151,-148,-114,-117,-143,-150,-149,-146,-113,-115,-116,-145,]),'ADDITION_ASSIGNMENT':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,78,111,116,149,159,164,171,175,177,208,217,218,221,238,],[-125,95,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,-147,-144,-151,-148,-114,-117,-143,-150,-149,-146,-113,-115,-116,-145,]),'SUBTRACTION_ASSIGNMENT':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,78,111,116,149,159,164,171,175,177,208,217,218,221,238,],[-125,96,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,-147,-144,-151,-148,-114,-117,-143,-150,-149,-146,-113,-115,-116,-145,]),'MULTIPLICATION_ASSIGNMENT':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,78,111,116,149,159,164,171,175,177,208,217,218,221,238,],[-125,97,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,-147,-144,-151,-148,-114,-117,-143,-150,-149,-146,-113,-115,-116,-145,]),'DIVISION_ASSIGNMENT':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,78,111,116,149,159,164,171,175,177,208,217,218,221,238,],[-125,98,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,-147,-144,-151,-148,-114,-117,-143,-150,-149,-146,-113,-115,-116,-145,]),'MODULO_ASSIGNMENT':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,78,111,116,149,159,164,171,175,177,208,217,218,221,238,],[-125,99,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,-147,-144,-151,-148,-114,-117,-143,-150,-149,-146,-113,-115,-116,-145,]),'EXPONENTIATION_ASSIGNMENT':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,78,111,116,149,159,164,171,175,177,208,217,218,221,238,],[-125,100,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,-147,-144,-151,-148,-114,-117,-143,-150,-149,-146,-113,-115,-116,-145,]),'FLOOR_DIVISION_ASSIGNMENT':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,78,111,116,149,159,164,171,175,177,208,217,218,221,238,],[-125,101,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,-147,-144,-151,-148,-114,-117,-143,-150,-149,-146,-113,-115,-116,-145,]),'STAR':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,66,68,69,77,78,81,105,111,116,139,144,149,159,164,166,171,175,177,195,196,197,198,199,200,208,217,218,221,238,],[-125,-112,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,140,-107,-110,-112,-147,-112,-112,-144,-151,-108,-109,-148,-114,-117,-111,-143,-150,-149,140,140,-103,-104,-105,-106,-146,-113,-115,-116,-145,]),'SLASH':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,66,68,69,77,78,81,105,111,116,139,144,149,159,164,166,171,175,177,195,196,197,198,199,200,208,217,218,221,238,],[-125,-112,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,141,-107,-110,-112,-147,-112,-112,-144,-151,-108,-109,-148,-114,-117,-111,-143,-150,-149,141,141,-103,-104,-105,-106,-146,-113,-115,-116,-145,]),'DOUBLE_SLASH':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,66,68,69,77,78,81,105,111,116,139,144,149,159,164,166,171,175,177,195,196,197,198,199,200,208,217,218,221,238,],[-125,-112,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,142,-107,-110,-112,-147,-112,-112,-144,-151,-108,-109,-148,-114,-117,-111,-143,-150,-149,142,142,-103,-104,-105,-106,-146,-113,-115,-116,-145,]),'PERCENT':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,66,68,69,77,78,81,105,111,116,139,144,149,159,164,166,171,175,177,195,196,197,198,199,200,208,217,218,221,238,],[-125,-112,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,143,-107,-110,-112,-147,-112,-112,-144,-151,-108,-109,-148,-114,-117,-111,-143,-150,-149,143,143,-103,-104,-105,-106,-146,-113,-115,-116,-145,]),'L_SHIFT':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,63,64,66,68,69,77,78,81,105,111,116,139,144,149,159,164,166,171,175,177,192,193,194,195,196,197,198,199,200,208,217,218,221,238,],[-125,-112,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,135,-99,-102,-107,-110,-112,-147,-112,-112,-144,-151,-108,-109,-148,-114,-117,-111,-143,-150,-149,135,-97,-98,-100,-101,-103,-104,-105,-106,-146,-113,-115,-116,-145,]),'R_SHIFT':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,63,64,66,68,69,77,78,81,105,111,116,139,144,149,159,164,166,171,175,177,192,193,194,195,196,197,198,199,200,208,217,218,221,238,],[-125,-112,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,136,-99,-102,-107,-110,-112,-147,-112,-112,-144,-151,-108,-109,-148,-114,-117,-111,-143,-150,-149,136,-97,-98,-100,-101,-103,-104,-105,-106,-146,-113,-115,-116,-145,]),'AMPERSAND':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,62,63,64,66,68,69,77,78,81,105,111,116,139,144,149,159,164,166,171,175,177,191,192,193,194,195,196,197,198,199,200,208,217,218,221,238,],[-125,-112,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,134,-96,-99,-102,-107,-110,-112,-147,-112,-112,-144,-151,-108,-109,-148,-114,-117,-111,-143,-150,-149,134,-95,-97,-98,-100,-101,-103,-104,-105,-106,-146,-113,-115,-116,-145,]),'CARET':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,61,62,63,64,66,68,69,77,78,81,105,111,116,139,144,149,159,164,166,171,175,177,180,191,192,193,194,195,196,197,198,199,200,208,217,218,221,238,],[-125,-112,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,133,-94,-96,-99,-102,-107,-110,-112,-147,-112,-112,-144,-151,-108,-109,-148,-114,-117,-111,-143,-150,-149,133,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-146,-113,-115,-116,-145,]),'PIPE':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,60,61,62,63,64,66,68,69,77,78,81,105,111,116,139,144,149,159,164,166,171,175,177,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,208,217,218,221,231,232,238,],[-125,-112,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,122,-92,-94,-96,-99,-102,-107,-110,-112,-147,-112,-112,-144,-151,-108,-109,-148,-114,-117,-111,-143,-150,-149,-91,122,122,122,122,122,122,122,122,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-146,-113,-115,-116,122,122,-145,]),'EQUALITY':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,60,61,62,63,64,66,68,69,77,78,81,105,111,116,121,123,139,144,149,159,164,166,171,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,208,217,218,221,231,232,238,],[-125,-112,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,124,-92,-94,-96,-99,-102,-107,-110,-112,-147,-112,-112,-144,-151,124,-80,-108,-109,-148,-114,-117,-111,-143,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-146,-113,-115,-116,-87,-88,-145,]),'INEQUALITY':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,60,61,62,63,64,66,68,69,77,78,81,105,111,116,121,123,139,144,149,159,164,166,171,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,208,217,218,221,231,232,238,],[-125,-112,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,125,-92,-94,-96,-99,-102,-107,-110,-112,-147,-112,-112,-144,-151,125,-80,-108,-109,-148,-114,-117,-111,-143,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-146,-113,-115,-116,-87,-88,-145,]),'GREATER_EQUAL':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,60,61,62,63,64,66,68,69,77,78,81,105,111,116,121,123,139,144,149,159,164,166,171,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,208,217,218,221,231,232,238,],[-125,-112,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,126,-92,-94,-96,-99,-102,-107,-110,-112,-147,-112,-112,-144,-151,126,-80,-108,-109,-148,-114,-117,-111,-143,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-146,-113,-115,-116,-87,-88,-145,]),'LESSER_EQUAL':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,60,61,62,63,64,66,68,69,77,78,81,105,111,116,121,123,139,144,149,159,164,166,171,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,208,217,218,221,231,232,238,],[-125,-112,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,127,-92,-94,-96,-99,-102,-107,-110,-112,-147,-112,-112,-144,-151,127,-80,-108,-109,-148,-114,-117,-111,-143,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-146,-113,-115,-116,-87,-88,-145,]),'GREATER':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,60,61,62,63,64,66,68,69,77,78,81,105,111,116,121,123,139,144,149,159,164,166,171,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,208,217,218,221,231,232,238,],[-125,-112,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,128,-92,-94,-96,-99,-102,-107,-110,-112,-147,-112,-112,-144,-151,128,-80,-108,-109,-148,-114,-117,-111,-143,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-146,-113,-115,-116,-87,-88,-145,]),'LESSER':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,60,61,62,63,64,66,68,69,77,78,81,105,111,116,121,123,139,144,149,159,164,166,171,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,208,217,218,221,231,232,238,],[-125,-112,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,129,-92,-94,-96,-99,-102,-107,-110,-112,-147,-112,-112,-144,-151,129,-80,-108,-109,-148,-114,-117,-111,-143,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-146,-113,-115,-116,-87,-88,-145,]),'IS':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,60,61,62,63,64,66,68,69,77,78,81,105,111,116,121,123,139,144,149,159,164,166,171,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,208,217,218,221,231,232,238,],[-125,-112,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,132,-92,-94,-96,-99,-102,-107,-110,-112,-147,-112,-112,-144,-151,132,-80,-108,-109,-148,-114,-117,-111,-143,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-146,-113,-115,-116,-87,-88,-145,]),'IN':([14,22,36,38,39,40,41,42,43,44,45,46,47,49,50,51,52,53,54,55,60,61,62,63,64,66,68,69,77,78,81,83,84,105,111,116,121,123,130,139,144,149,155,159,164,165,166,171,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,208,217,218,221,231,232,238,],[-125,-112,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-141,-142,-136,-137,-138,-139,-140,131,-92,-94,-96,-99,-102,-107,-110,-112,-147,-112,153,154,-112,-144,-151,131,-80,187,-108,-109,-148,-24,-114,-117,-25,-111,-143,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-146,-113,-115,-116,-87,-88,-145,]),'AND':([14,22,36,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,77,78,81,105,111,116,120,121,123,139,144,149,159,164,166,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,208,217,218,221,231,232,238,],[-125,-112,-118,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,114,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-112,-147,-112,-112,-144,-151,-75,-77,-80,-108,-109,-148,-114,-117,-111,-143,114,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-146,-113,-115,-116,-87,-88,-145,]),'OR':([14,22,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,77,78,81,105,111,116,120,121,123,139,144,149,159,164,166,171,172,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,208,217,218,221,231,232,238,],[-125,-112,-118,113,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-112,-147,-112,-112,-144,-151,-75,-77,-80,-108,-109,-148,-114,-117,-111,-143,113,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-146,-113,-115,-116,-87,-88,-145,]),'R_PARENTHESIS':([14,15,17,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,76,77,78,79,81,89,111,116,120,121,123,139,144,146,148,149,151,156,158,159,164,166,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,202,203,205,207,208,212,217,218,221,231,232,238,249,250,252,],[-125,78,-68,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,78,147,-147,149,-112,159,-144,-151,-75,-77,-80,-108,-109,204,208,-148,213,-67,217,-114,-117,-111,-143,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-56,234,-54,238,-146,244,-113,-115,-116,-87,-88,-145,-69,-55,-53,]),'COLON':([14,17,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,78,80,81,82,90,102,111,116,119,120,121,123,139,144,149,156,159,161,163,164,166,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,204,208,213,215,216,217,218,219,220,221,223,229,231,232,234,238,242,244,249,254,],[-125,-68,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-147,150,-112,152,163,167,-144,-151,178,-75,-77,-80,-108,-109,-148,-67,-114,163,163,-117,-111,-143,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,236,-146,245,246,247,-113,-115,163,163,-116,163,178,-87,-88,251,-145,255,257,-69,262,]),'R_SQB':([14,17,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,57,59,60,61,62,63,64,66,68,69,78,81,110,111,116,120,121,123,139,144,149,156,159,160,161,162,163,164,166,171,173,174,175,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,208,217,218,221,222,223,224,231,232,238,248,249,],[-125,-68,111,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-147,-112,171,-144,-151,-75,-77,-80,-108,-109,-148,-67,-114,218,221,-120,-124,-117,-111,-143,-71,-73,-150,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-146,-113,-115,-116,-121,-122,-123,-87,-88,-145,-119,-69,]),'R_CB':([14,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,59,60,61,62,63,64,66,68,69,78,81,111,115,116,117,118,119,120,121,123,139,144,149,156,159,164,166,171,173,174,175,176,177,179,180,181,182,183,184,185,186,188,190,191,192,193,194,195,196,197,198,199,200,208,217,218,221,228,230,231,232,238,249,],[-125,-118,-70,-126,-127,-128,-129,-130,-131,-132,-133,-134,-135,-72,-141,-142,-136,-137,-138,-139,-140,116,-74,-76,-78,-92,-94,-96,-99,-102,-107,-110,-147,-112,-144,175,-151,177,-154,-68,-75,-77,-80,-108,-109,-148,-67,-114,-117,-111,-143,-71,-73,-150,-153,-149,-79,-91,-81,-82,-83,-84,-85,-86,-89,-90,-93,-95,-97,-98,-100,-101,-103,-104,-105,-106,-146,-113,-115,-116,-152,-155,-87,-88,-145,-69,]),'INDENT':([210,],[243,]),}
+
+_lr_action = {}
+for _k, _v in _lr_action_items.items():
+   for _x,_y in zip(_v[0],_v[1]):
+      if not _x in _lr_action:  _lr_action[_x] = {}
+      _lr_action[_x][_k] = _y
+del _lr_action_items
+
+_lr_goto_items = {'file':([0,],[1,]),'statements':([0,243,],[2,256,]),'statement':([0,2,243,256,],[4,71,4,71,]),'compound_stmt':([0,2,243,256,],[5,5,5,5,]),'simple_stmts':([0,2,150,152,167,236,243,245,246,247,251,255,256,257,262,],[6,6,211,211,211,211,6,211,211,211,211,211,6,211,211,]),'function_def':([0,2,243,256,],[7,7,7,7,]),'if_stmt':([0,2,243,256,],[8,8,8,8,]),'class_def':([0,2,243,256,],[9,9,9,9,]),'for_stmt':([0,2,243,256,],[10,10,10,10,]),'while_stmt':([0,2,243,256,],[11,11,11,11,]),'simple_stmt':([0,2,73,150,152,167,236,243,245,246,247,251,255,256,257,262,],[12,12,145,12,12,12,12,12,12,12,12,12,12,12,12,12,]),'expression':([0,2,15,16,23,31,32,35,56,73,76,87,88,89,90,148,150,151,152,153,154,161,163,167,176,178,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[17,17,79,80,102,17,17,17,119,17,79,156,17,17,161,17,17,212,17,17,17,220,223,17,229,230,17,220,220,220,249,250,17,254,17,17,17,17,17,17,17,17,17,]),'targets':([0,2,19,31,73,150,152,167,236,243,245,246,247,251,255,256,257,262,],[20,20,83,104,20,20,20,20,20,20,20,20,20,20,20,20,20,20,]),'expressions':([0,2,31,32,35,56,73,88,89,148,150,152,153,154,167,206,236,243,245,246,247,251,255,256,257,262,],[21,21,103,106,110,117,21,157,158,207,21,21,215,216,21,237,21,21,21,21,21,21,21,21,21,21,]),'primary':([0,2,15,16,19,23,31,32,35,56,58,65,67,73,76,86,87,88,89,90,93,94,112,113,114,122,124,125,126,127,128,129,131,132,133,134,135,136,137,138,140,141,142,143,148,150,151,152,153,154,161,163,167,176,178,187,189,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[22,22,77,81,84,81,105,81,81,81,81,81,81,22,81,155,81,81,81,81,165,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,22,81,22,81,81,81,81,22,81,81,81,81,81,81,81,81,81,81,22,81,22,22,22,22,22,22,22,22,22,]),'assignment':([0,2,73,150,152,167,236,243,245,246,247,251,255,256,257,262,],[24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,]),'return_stmt':([0,2,73,150,152,167,236,243,245,246,247,251,255,256,257,262,],[25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,]),'del_stmt':([0,2,73,150,152,167,236,243,245,246,247,251,255,256,257,262,],[27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,]),'global_stmt':([0,2,73,150,152,167,236,243,245,246,247,251,255,256,257,262,],[30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,]),'target_assignment_chain':([0,2,73,150,152,167,236,243,245,246,247,251,255,256,257,262,],[31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,]),'atomic':([0,2,15,16,19,23,31,32,35,56,58,65,67,73,76,86,87,88,89,90,93,94,112,113,114,122,124,125,126,127,128,129,131,132,133,134,135,136,137,138,140,141,142,143,148,150,151,152,153,154,161,163,167,176,178,187,189,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,]),'disjunction':([0,2,15,16,23,31,32,35,56,73,76,87,88,89,90,112,148,150,151,152,153,154,161,163,167,176,178,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,172,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,]),'strings':([0,2,15,16,19,23,31,32,35,56,58,65,67,73,76,86,87,88,89,90,93,94,112,113,114,122,124,125,126,127,128,129,131,132,133,134,135,136,137,138,140,141,142,143,148,150,151,152,153,154,161,163,167,176,178,187,189,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,]),'number':([0,2,15,16,19,23,31,32,35,56,58,65,67,73,76,86,87,88,89,90,93,94,112,113,114,122,124,125,126,127,128,129,131,132,133,134,135,136,137,138,140,141,142,143,148,150,151,152,153,154,161,163,167,176,178,187,189,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,]),'tuple':([0,2,15,16,19,23,31,32,35,56,58,65,67,73,76,86,87,88,89,90,93,94,112,113,114,122,124,125,126,127,128,129,131,132,133,134,135,136,137,138,140,141,142,143,148,150,151,152,153,154,161,163,167,176,178,187,189,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,]),'group':([0,2,15,16,19,23,31,32,35,56,58,65,67,73,76,86,87,88,89,90,93,94,112,113,114,122,124,125,126,127,128,129,131,132,133,134,135,136,137,138,140,141,142,143,148,150,151,152,153,154,161,163,167,176,178,187,189,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,]),'list':([0,2,15,16,19,23,31,32,35,56,58,65,67,73,76,86,87,88,89,90,93,94,112,113,114,122,124,125,126,127,128,129,131,132,133,134,135,136,137,138,140,141,142,143,148,150,151,152,153,154,161,163,167,176,178,187,189,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,]),'dict':([0,2,15,16,19,23,31,32,35,56,58,65,67,73,76,86,87,88,89,90,93,94,112,113,114,122,124,125,126,127,128,129,131,132,133,134,135,136,137,138,140,141,142,143,148,150,151,152,153,154,161,163,167,176,178,187,189,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,]),'set':([0,2,15,16,19,23,31,32,35,56,58,65,67,73,76,86,87,88,89,90,93,94,112,113,114,122,124,125,126,127,128,129,131,132,133,134,135,136,137,138,140,141,142,143,148,150,151,152,153,154,161,163,167,176,178,187,189,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,]),'conjunction':([0,2,15,16,23,31,32,35,56,73,76,87,88,89,90,112,113,148,150,151,152,153,154,161,163,167,176,178,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,173,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,]),'inversion':([0,2,15,16,23,31,32,35,56,58,73,76,87,88,89,90,112,113,114,148,150,151,152,153,154,161,163,167,176,178,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[57,57,57,57,57,57,57,57,57,120,57,57,57,57,57,57,57,57,174,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,]),'comparison':([0,2,15,16,23,31,32,35,56,58,73,76,87,88,89,90,112,113,114,148,150,151,152,153,154,161,163,167,176,178,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,]),'bitwise_or':([0,2,15,16,23,31,32,35,56,58,73,76,87,88,89,90,112,113,114,124,125,126,127,128,129,131,132,148,150,151,152,153,154,161,163,167,176,178,187,189,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,181,182,183,184,185,186,188,190,60,60,60,60,60,60,60,60,60,60,60,231,232,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,]),'bitwise_xor':([0,2,15,16,23,31,32,35,56,58,73,76,87,88,89,90,112,113,114,122,124,125,126,127,128,129,131,132,148,150,151,152,153,154,161,163,167,176,178,187,189,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,180,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,]),'bitwise_and':([0,2,15,16,23,31,32,35,56,58,73,76,87,88,89,90,112,113,114,122,124,125,126,127,128,129,131,132,133,148,150,151,152,153,154,161,163,167,176,178,187,189,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,191,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,]),'shift_expr':([0,2,15,16,23,31,32,35,56,58,73,76,87,88,89,90,112,113,114,122,124,125,126,127,128,129,131,132,133,134,148,150,151,152,153,154,161,163,167,176,178,187,189,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,192,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,63,]),'sum':([0,2,15,16,23,31,32,35,56,58,73,76,87,88,89,90,112,113,114,122,124,125,126,127,128,129,131,132,133,134,135,136,148,150,151,152,153,154,161,163,167,176,178,187,189,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,193,194,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,]),'term':([0,2,15,16,23,31,32,35,56,58,73,76,87,88,89,90,112,113,114,122,124,125,126,127,128,129,131,132,133,134,135,136,137,138,148,150,151,152,153,154,161,163,167,176,178,187,189,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,195,196,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,]),'factor':([0,2,15,16,23,31,32,35,56,58,65,67,73,76,87,88,89,90,94,112,113,114,122,124,125,126,127,128,129,131,132,133,134,135,136,137,138,140,141,142,143,148,150,151,152,153,154,161,163,167,176,178,187,189,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[68,68,68,68,68,68,68,68,68,68,139,144,68,68,68,68,68,68,166,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,197,198,199,200,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,]),'power':([0,2,15,16,23,31,32,35,56,58,65,67,73,76,87,88,89,90,94,112,113,114,122,124,125,126,127,128,129,131,132,133,134,135,136,137,138,140,141,142,143,148,150,151,152,153,154,161,163,167,176,178,187,189,206,219,220,223,227,233,236,241,243,245,246,247,251,255,256,257,262,],[69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,]),'augmentation_assignment':([22,],[88,]),'namelist':([33,34,],[107,109,]),'kvpairs':([56,],[115,]),'kvpair':([56,176,],[118,228,]),'compare_op_list':([60,],[121,]),'compare_op':([60,121,],[123,179,]),'slices':([90,],[160,]),'slice':([90,161,163,219,220,223,],[162,222,224,248,222,222,]),'parameters':([146,],[203,]),'parameter':([146,235,],[205,252,]),'block':([150,152,167,236,245,246,247,251,255,257,262,],[209,214,225,253,258,259,260,261,263,265,266,]),'elif_stmt':([209,266,],[239,267,]),'else_block':([209,266,],[240,268,]),}
+
+_lr_goto = {}
+for _k, _v in _lr_goto_items.items():
+   for _x, _y in zip(_v[0], _v[1]):
+       if not _x in _lr_goto: _lr_goto[_x] = {}
+       _lr_goto[_x][_k] = _y
+del _lr_goto_items
+_lr_productions = [
+  ("S' -> file","S'",1,None,None,None),
+  ('file -> statements ENDMARKER','file',2,'p_file','Parser.py',41),
+  ('file -> ENDMARKER','file',1,'p_file','Parser.py',42),
+  ('statements -> statements statement','statements',2,'p_statements','Parser.py',52),
+  ('statements -> statements NEWLINE','statements',2,'p_statements','Parser.py',53),
+  ('statements -> statement','statements',1,'p_statements','Parser.py',54),
+  ('statement -> compound_stmt','statement',1,'p_statement','Parser.py',66),
+  ('statement -> simple_stmts','statement',1,'p_statement','Parser.py',67),
+  ('simple_stmts -> simple_stmts SEMICOLON simple_stmt NEWLINE','simple_stmts',4,'p_simple_stmts','Parser.py',73),
+  ('simple_stmts -> simple_stmt NEWLINE','simple_stmts',2,'p_simple_stmts','Parser.py',74),
+  ('simple_stmts -> simple_stmt','simple_stmts',1,'p_simple_stmts','Parser.py',75),
+  ('simple_stmt -> assignment','simple_stmt',1,'p_simple_stmt','Parser.py',86),
+  ('simple_stmt -> expressions','simple_stmt',1,'p_simple_stmt','Parser.py',87),
+  ('simple_stmt -> return_stmt','simple_stmt',1,'p_simple_stmt','Parser.py',88),
+  ('simple_stmt -> PASS','simple_stmt',1,'p_simple_stmt','Parser.py',89),
+  ('simple_stmt -> del_stmt','simple_stmt',1,'p_simple_stmt','Parser.py',90),
+  ('simple_stmt -> BREAK','simple_stmt',1,'p_simple_stmt','Parser.py',91),
+  ('simple_stmt -> CONTINUE','simple_stmt',1,'p_simple_stmt','Parser.py',92),
+  ('simple_stmt -> global_stmt','simple_stmt',1,'p_simple_stmt','Parser.py',93),
+  ('compound_stmt -> function_def','compound_stmt',1,'p_compound_stmt','Parser.py',102),
+  ('compound_stmt -> if_stmt','compound_stmt',1,'p_compound_stmt','Parser.py',103),
+  ('compound_stmt -> class_def','compound_stmt',1,'p_compound_stmt','Parser.py',104),
+  ('compound_stmt -> for_stmt','compound_stmt',1,'p_compound_stmt','Parser.py',105),
+  ('compound_stmt -> while_stmt','compound_stmt',1,'p_compound_stmt','Parser.py',106),
+  ('targets -> targets COMMA primary','targets',3,'p_targets','Parser.py',111),
+  ('targets -> primary COMMA primary','targets',3,'p_targets','Parser.py',112),
+  ('target_assignment_chain -> target_assignment_chain targets ASSIGNMENT','target_assignment_chain',3,'p_target_assignment_chain','Parser.py',122),
+  ('target_assignment_chain -> target_assignment_chain primary ASSIGNMENT','target_assignment_chain',3,'p_target_assignment_chain','Parser.py',123),
+  ('target_assignment_chain -> targets ASSIGNMENT','target_assignment_chain',2,'p_target_assignment_chain','Parser.py',124),
+  ('target_assignment_chain -> primary ASSIGNMENT','target_assignment_chain',2,'p_target_assignment_chain','Parser.py',125),
+  ('assignment -> L_PARENTHESIS primary R_PARENTHESIS ASSIGNMENT expressions','assignment',5,'p_assignment','Parser.py',146),
+  ('assignment -> primary augmentation_assignment expressions','assignment',3,'p_assignment','Parser.py',147),
+  ('assignment -> target_assignment_chain expressions','assignment',2,'p_assignment','Parser.py',148),
+  ('augmentation_assignment -> ADDITION_ASSIGNMENT','augmentation_assignment',1,'p_augmentation_assignment','Parser.py',161),
+  ('augmentation_assignment -> SUBTRACTION_ASSIGNMENT','augmentation_assignment',1,'p_augmentation_assignment','Parser.py',162),
+  ('augmentation_assignment -> MULTIPLICATION_ASSIGNMENT','augmentation_assignment',1,'p_augmentation_assignment','Parser.py',163),
+  ('augmentation_assignment -> DIVISION_ASSIGNMENT','augmentation_assignment',1,'p_augmentation_assignment','Parser.py',164),
+  ('augmentation_assignment -> MODULO_ASSIGNMENT','augmentation_assignment',1,'p_augmentation_assignment','Parser.py',165),
+  ('augmentation_assignment -> EXPONENTIATION_ASSIGNMENT','augmentation_assignment',1,'p_augmentation_assignment','Parser.py',166),
+  ('augmentation_assignment -> FLOOR_DIVISION_ASSIGNMENT','augmentation_assignment',1,'p_augmentation_assignment','Parser.py',167),
+  ('return_stmt -> RETURN expressions','return_stmt',2,'p_return_stmt','Parser.py',173),
+  ('return_stmt -> RETURN','return_stmt',1,'p_return_stmt','Parser.py',174),
+  ('global_stmt -> GLOBAL namelist','global_stmt',2,'p_global_stmt','Parser.py',183),
+  ('del_stmt -> DEL namelist','del_stmt',2,'p_del_stmt','Parser.py',189),
+  ('namelist -> namelist COMMA IDENTIFIER','namelist',3,'p_namelist','Parser.py',195),
+  ('namelist -> IDENTIFIER','namelist',1,'p_namelist','Parser.py',196),
+  ('block -> NEWLINE INDENT statements DEDENT','block',4,'p_block','Parser.py',209),
+  ('block -> simple_stmts','block',1,'p_block','Parser.py',210),
+  ('class_def -> CLASS IDENTIFIER L_PARENTHESIS expression R_PARENTHESIS COLON block','class_def',7,'p_class_def','Parser.py',221),
+  ('class_def -> CLASS IDENTIFIER L_PARENTHESIS R_PARENTHESIS COLON block','class_def',6,'p_class_def','Parser.py',222),
+  ('class_def -> CLASS IDENTIFIER COLON block','class_def',4,'p_class_def','Parser.py',223),
+  ('function_def -> DEF IDENTIFIER L_PARENTHESIS parameters R_PARENTHESIS COLON block','function_def',7,'p_function_def','Parser.py',234),
+  ('function_def -> DEF IDENTIFIER L_PARENTHESIS R_PARENTHESIS COLON block','function_def',6,'p_function_def','Parser.py',235),
+  ('parameters -> parameters COMMA parameter','parameters',3,'p_parameters','Parser.py',245),
+  ('parameters -> parameter','parameters',1,'p_parameters','Parser.py',246),
+  ('parameter -> IDENTIFIER ASSIGNMENT expression','parameter',3,'p_parameter','Parser.py',254),
+  ('parameter -> IDENTIFIER','parameter',1,'p_parameter','Parser.py',255),
+  ('if_stmt -> IF expression COLON block elif_stmt','if_stmt',5,'p_if_stmt','Parser.py',264),
+  ('if_stmt -> IF expression COLON block else_block','if_stmt',5,'p_if_stmt','Parser.py',265),
+  ('if_stmt -> IF expression COLON block','if_stmt',4,'p_if_stmt','Parser.py',266),
+  ('elif_stmt -> ELIF expression COLON block elif_stmt','elif_stmt',5,'p_elif_stmt','Parser.py',276),
+  ('elif_stmt -> ELIF expression COLON block else_block','elif_stmt',5,'p_elif_stmt','Parser.py',277),
+  ('elif_stmt -> ELIF expression COLON block','elif_stmt',4,'p_elif_stmt','Parser.py',278),
+  ('else_block -> ELSE COLON block','else_block',3,'p_else_block','Parser.py',287),
+  ('while_stmt -> WHILE expression COLON block','while_stmt',4,'p_while_stmt','Parser.py',294),
+  ('for_stmt -> FOR targets IN expressions COLON block','for_stmt',6,'p_for_stmt','Parser.py',300),
+  ('for_stmt -> FOR primary IN expressions COLON block','for_stmt',6,'p_for_stmt','Parser.py',301),
+  ('expressions -> expressions COMMA expression','expressions',3,'p_expressions','Parser.py',313),
+  ('expressions -> expression','expressions',1,'p_expressions','Parser.py',314),
+  ('expression -> disjunction IF disjunction ELSE expression','expression',5,'p_expression','Parser.py',326),
+  ('expression -> disjunction','expression',1,'p_expression','Parser.py',327),
+  ('disjunction -> disjunction OR conjunction','disjunction',3,'p_disjunction','Parser.py',337),
+  ('disjunction -> conjunction','disjunction',1,'p_disjunction','Parser.py',338),
+  ('conjunction -> conjunction AND inversion','conjunction',3,'p_conjunction','Parser.py',348),
+  ('conjunction -> inversion','conjunction',1,'p_conjunction','Parser.py',349),
+  ('inversion -> NOT inversion','inversion',2,'p_inversion','Parser.py',359),
+  ('inversion -> comparison','inversion',1,'p_inversion','Parser.py',360),
+  ('comparison -> bitwise_or compare_op_list','comparison',2,'p_comparison','Parser.py',372),
+  ('comparison -> bitwise_or','comparison',1,'p_comparison','Parser.py',373),
+  ('compare_op_list -> compare_op_list compare_op','compare_op_list',2,'p_compare_op_list','Parser.py',382),
+  ('compare_op_list -> compare_op','compare_op_list',1,'p_compare_op_list','Parser.py',383),
+  ('compare_op -> EQUALITY bitwise_or','compare_op',2,'p_compare_op','Parser.py',396),
+  ('compare_op -> INEQUALITY bitwise_or','compare_op',2,'p_compare_op','Parser.py',397),
+  ('compare_op -> GREATER_EQUAL bitwise_or','compare_op',2,'p_compare_op','Parser.py',398),
+  ('compare_op -> LESSER_EQUAL bitwise_or','compare_op',2,'p_compare_op','Parser.py',399),
+  ('compare_op -> GREATER bitwise_or','compare_op',2,'p_compare_op','Parser.py',400),
+  ('compare_op -> LESSER bitwise_or','compare_op',2,'p_compare_op','Parser.py',401),
+  ('compare_op -> NOT IN bitwise_or','compare_op',3,'p_compare_op','Parser.py',402),
+  ('compare_op -> IS NOT bitwise_or','compare_op',3,'p_compare_op','Parser.py',403),
+  ('compare_op -> IN bitwise_or','compare_op',2,'p_compare_op','Parser.py',404),
+  ('compare_op -> IS bitwise_or','compare_op',2,'p_compare_op','Parser.py',405),
+  ('bitwise_or -> bitwise_or PIPE bitwise_xor','bitwise_or',3,'p_bitwise_or','Parser.py',414),
+  ('bitwise_or -> bitwise_xor','bitwise_or',1,'p_bitwise_or','Parser.py',415),
+  ('bitwise_xor -> bitwise_xor CARET bitwise_and','bitwise_xor',3,'p_bitwise_xor','Parser.py',424),
+  ('bitwise_xor -> bitwise_and','bitwise_xor',1,'p_bitwise_xor','Parser.py',425),
+  ('bitwise_and -> bitwise_and AMPERSAND shift_expr','bitwise_and',3,'p_bitwise_and','Parser.py',434),
+  ('bitwise_and -> shift_expr','bitwise_and',1,'p_bitwise_and','Parser.py',435),
+  ('shift_expr -> shift_expr L_SHIFT sum','shift_expr',3,'p_shift_expr','Parser.py',444),
+  ('shift_expr -> shift_expr R_SHIFT sum','shift_expr',3,'p_shift_expr','Parser.py',445),
+  ('shift_expr -> sum','shift_expr',1,'p_shift_expr','Parser.py',446),
+  ('sum -> sum PLUS term','sum',3,'p_sum','Parser.py',458),
+  ('sum -> sum MINUS term','sum',3,'p_sum','Parser.py',459),
+  ('sum -> term','sum',1,'p_sum','Parser.py',460),
+  ('term -> term STAR factor','term',3,'p_term','Parser.py',468),
+  ('term -> term SLASH factor','term',3,'p_term','Parser.py',469),
+  ('term -> term DOUBLE_SLASH factor','term',3,'p_term','Parser.py',470),
+  ('term -> term PERCENT factor','term',3,'p_term','Parser.py',471),
+  ('term -> factor','term',1,'p_term','Parser.py',472),
+  ('factor -> PLUS factor','factor',2,'p_factor','Parser.py',480),
+  ('factor -> MINUS factor','factor',2,'p_factor','Parser.py',481),
+  ('factor -> power','factor',1,'p_factor','Parser.py',482),
+  ('power -> primary DOUBLE_STAR factor','power',3,'p_power','Parser.py',490),
+  ('power -> primary','power',1,'p_power','Parser.py',491),
+  ('primary -> primary L_PARENTHESIS expressions R_PARENTHESIS','primary',4,'p_primary','Parser.py',503),
+  ('primary -> primary L_PARENTHESIS R_PARENTHESIS','primary',3,'p_primary','Parser.py',504),
+  ('primary -> primary L_SQB slices R_SQB','primary',4,'p_primary','Parser.py',505),
+  ('primary -> primary L_SQB expression R_SQB','primary',4,'p_primary','Parser.py',506),
+  ('primary -> primary DOT IDENTIFIER','primary',3,'p_primary','Parser.py',507),
+  ('primary -> atomic','primary',1,'p_primary','Parser.py',508),
+  ('slices -> slices COMMA slice','slices',3,'p_slices','Parser.py',528),
+  ('slices -> slice','slices',1,'p_slices','Parser.py',529),
+  ('slice -> expression slice','slice',2,'p_slice','Parser.py',541),
+  ('slice -> COLON expression','slice',2,'p_slice','Parser.py',542),
+  ('slice -> COLON slice','slice',2,'p_slice','Parser.py',543),
+  ('slice -> COLON','slice',1,'p_slice','Parser.py',544),
+  ('atomic -> IDENTIFIER','atomic',1,'p_atomic','Parser.py',556),
+  ('atomic -> TRUE','atomic',1,'p_atomic','Parser.py',557),
+  ('atomic -> FALSE','atomic',1,'p_atomic','Parser.py',558),
+  ('atomic -> NONE','atomic',1,'p_atomic','Parser.py',559),
+  ('atomic -> strings','atomic',1,'p_atomic','Parser.py',560),
+  ('atomic -> number','atomic',1,'p_atomic','Parser.py',561),
+  ('atomic -> tuple','atomic',1,'p_atomic','Parser.py',562),
+  ('atomic -> group','atomic',1,'p_atomic','Parser.py',563),
+  ('atomic -> list','atomic',1,'p_atomic','Parser.py',564),
+  ('atomic -> dict','atomic',1,'p_atomic','Parser.py',565),
+  ('atomic -> set','atomic',1,'p_atomic','Parser.py',566),
+  ('number -> NUMBER','number',1,'p_number','Parser.py',580),
+  ('number -> F_NUMBER','number',1,'p_number','Parser.py',581),
+  ('number -> BIN_NUMBER','number',1,'p_number','Parser.py',582),
+  ('number -> HEX_NUMBER','number',1,'p_number','Parser.py',583),
+  ('number -> OCT_NUMBER','number',1,'p_number','Parser.py',584),
+  ('strings -> STRING','strings',1,'p_strings','Parser.py',591),
+  ('strings -> TRIPLE_STRING','strings',1,'p_strings','Parser.py',592),
+  ('list -> L_SQB expressions R_SQB','list',3,'p_list','Parser.py',599),
+  ('list -> L_SQB R_SQB','list',2,'p_list','Parser.py',600),
+  ('tuple -> L_PARENTHESIS expression COMMA expressions R_PARENTHESIS','tuple',5,'p_tuple','Parser.py',608),
+  ('tuple -> L_PARENTHESIS expression COMMA R_PARENTHESIS','tuple',4,'p_tuple','Parser.py',609),
+  ('tuple -> L_PARENTHESIS R_PARENTHESIS','tuple',2,'p_tuple','Parser.py',610),
+  ('group -> L_PARENTHESIS expression R_PARENTHESIS','group',3,'p_group','Parser.py',623),
+  ('set -> L_CB expressions R_CB','set',3,'p_set','Parser.py',628),
+  ('dict -> L_CB kvpairs R_CB','dict',3,'p_dict','Parser.py',634),
+  ('dict -> L_CB R_CB','dict',2,'p_dict','Parser.py',635),
+  ('kvpairs -> kvpairs COMMA kvpair','kvpairs',3,'p_kvpairs','Parser.py',643),
+  ('kvpairs -> kvpairs COMMA','kvpairs',2,'p_kvpairs','Parser.py',644),
+  ('kvpairs -> kvpair','kvpairs',1,'p_kvpairs','Parser.py',645),
+  ('kvpair -> expression COLON expression','kvpair',3,'p_kvpair','Parser.py',657),
+]
@@ -6,7 +6,7 @@
 #include "../Collections/Map.hpp"
 
 namespace Builtin {
-  var iter(const std::vector<ObjectPtr>& params) {
+  var iter(Args params) {
     if (params.size() != 1) {
       std::cerr << "iter: Invalid number of arguments\n";
       return nullptr;
@@ -15,88 +15,97 @@ namespace Builtin {
     return (Iterator) params[0]->getIterator();
   }
 
-  var next(const std::vector<ObjectPtr>& params) {
+  var next(Args params) {
     if (params.size() != 1) {
       std::cerr << "next: Invalid number of arguments\n";
       return nullptr;
     }
 
-    return params[0]->Call("__next__", {});
+    return params[0]->Call(Methods::next, {});
   }
 
-  var len(const std::vector<ObjectPtr>& params) {
+  var len(Args params) {
     if (params.size() != 1) {
       std::cerr << "len: Invalid number of arguments\n";
       return nullptr;
     }
 
-    return params[0]->Call("__len__", {});
+    return params[0]->Call(Methods::len, {});
   }
 
-  var sum(const std::vector<ObjectPtr>& params) {
+  var sum(Args params) {
     if (params.size() != 1) {
       std::cerr << "sum: Invalid number of arguments\n";
       return nullptr;
     }
 
-    return params[0]->Call("__sum__", {});
+    return params[0]->Call(Methods::sum, {});
   }
 
-  var min(const std::vector<ObjectPtr>& params) {
+  var min(Args params) {
     if (params.size() != 1) {
       std::cerr << "min: Invalid number of arguments\n";
       return nullptr;
     }
 
-    return params[0]->Call("__min__", {});
+    return params[0]->Call(Methods::min, {});
   }
 
-  var max(const std::vector<ObjectPtr>& params) {
+  var max(Args params) {
     if (params.size() != 1) {
       std::cerr << "max: Invalid number of arguments\n";
       return nullptr;
     }
 
-    return params[0]->Call("__max__", {});
+    return params[0]->Call(Methods::max, {});
   }
 
-  var tuple(const std::vector<ObjectPtr>& params) {
+  var sorted(const var& iterable, const Sequence::Key& key) {
+    // Always a new list, even from a list
+    var result = list({iterable.getValue()});
+    if (auto elements = objectCast<List>(result.getValue())) {
+      elements->sortBy(key);
+    }
+    return result;
+  }
+
+  var tuple(Args params) {
     if (params.size() > 1) {
       std::cerr << "tuple: Invalid number of arguments\n";
       return nullptr;
     }
 
     if (params.empty()) {
-      return (var) std::make_shared<Tuple>();
+      return (var) makeRef<Tuple>();
     }
 
     auto obj = params[0];
 
     // From None
     if (! obj) {
-      return (var) std::make_shared<Tuple>();
+      return (var) makeRef<Tuple>();
     }
 
     // From tuple
     {
-      if (auto tuple = std::dynamic_pointer_cast<Tuple>(obj)) {
-        return (var) std::make_shared<Tuple>(tuple->getValue());
+      if (auto tuple = objectCast<Tuple>(obj)) {
+        return (var) makeRef<Tuple>(tuple->getValue());
       }
     }
 
     // From list
     {
-      if (auto list = std::dynamic_pointer_cast<List>(obj)) {
-        return (var) std::make_shared<Tuple>(list->getValue());
+      if (auto list = objectCast<List>(obj)) {
+        return (var) makeRef<Tuple>(list->getValue());
       }
     }
 
     // From set
     {
-      if (auto set = std::dynamic_pointer_cast<Set>(obj)) {
-        const std::unordered_set<var>& elements = set->getValue();
+      if (auto set = objectCast<Set>(obj)) {
+        const SetStorage<var>& elements = set->getValue();
 
-        return (var) std::make_shared<Tuple>(
+        return (var) makeRef<Tuple>(
           std::vector<var>(elements.begin(), elements.end())
         );
       }
@@ -104,59 +113,66 @@ namespace Builtin {
 
     // From dict
     {
-      if (auto map = std::dynamic_pointer_cast<Map>(obj)) {
-        const std::unordered_map<var, var>& elements = map->getValue();
+      if (auto map = objectCast<Map>(obj)) {
+        const Dict& elements = map->getValue();
         std::vector<var> keys;
 
         for (const auto& item: elements) {
           keys.push_back(item.first);
         }
 
-        return (var) std::make_shared<Tuple>(std::vector<var>(keys));
+        return (var) makeRef<Tuple>(std::vector<var>(keys));
+      }
+    }
+
+    // From dict keys, values or items
+    {
+      if (auto view = objectCast<MapView>(obj)) {
+        return (var) makeRef<Tuple>(view->elements());
       }
     }
 
-    std::cerr << "Unexpected type. Expected tuple, list, set or map.\n";
+    std::cerr << "Unexpected type. Expected tuple, list, set, map or map view.\n";
     return nullptr;
   }
 
-  var list(const std::vector<ObjectPtr>& params) {
+  var list(Args params) {
     if (params.size() > 1) {
       std::cerr << "list: Invalid number of arguments\n";
       return nullptr;
     }
 
     if (params.empty()) {
-      return (var) std::make_shared<List>();
+      return (var) makeRef<List>();
     }
 
     auto obj = params[0];
 
     // From None
     if (! obj) {
-      return (var) std::make_shared<List>();
+      return (var) makeRef<List>();
     }
 
     // From tuple
     {
-      if (auto tuple = std::dynamic_pointer_cast<Tuple>(obj)) {
-        return (var) std::make_shared<List>(tuple->getValue());
+      if (auto tuple = objectCast<Tuple>(obj)) {
+        return (var) makeRef<List>(tuple->getValue());
       }
     }
 
     // From list
     {
-      if (auto list = std::dynamic_pointer_cast<List>(obj)) {
-        return (var) std::make_shared<List>(list->getValue());
+      if (auto list = objectCast<List>(obj)) {
+        return (var) makeRef<List>(list->getValue());
       }
     }
 
     // From set
     {
-      if (auto set = std::dynamic_pointer_cast<Set>(obj)) {
-        const std::unordered_set<var>& elements = set->getValue();
+      if (auto set = objectCast<Set>(obj)) {
+        const SetStorage<var>& elements = set->getValue();
 
-        return (var) std::make_shared<List>(
+        return (var) makeRef<List>(
           std::vector<var>(elements.begin(), elements.end())
         );
       }
@@ -164,109 +180,126 @@ namespace Builtin {
 
     // From dict
     {
-      if (auto map = std::dynamic_pointer_cast<Map>(obj)) {
-        const std::unordered_map<var, var>& elements = map->getValue();
+      if (auto map = objectCast<Map>(obj)) {
+        const Dict& elements = map->getValue();
         std::vector<var> keys;
 
         for (const auto& item: elements) {
           keys.push_back(item.first);
         }
 
-        return (var) std::make_shared<List>(std::vector<var>(keys));
+        return (var) makeRef<List>(std::vector<var>(keys));
+      }
+    }
+
+    // From dict keys, values or items
+    {
+      if (auto view = objectCast<MapView>(obj)) {
+        return (var) makeRef<List>(view->elements());
       }
     }
 
-    std::cerr << "Unexpected type. Expected tuple, list, set or map.\n";
+    std::cerr << "Unexpected type. Expected tuple, list, set, map or map view.\n";
     return nullptr;
   }
 
-  var set(const std::vector<ObjectPtr>& params) {
+  var set(Args params) {
     if (params.size() > 1) {
       std::cerr << "set: Invalid number of arguments\n";
       return nullptr;
     }
 
     if (params.empty()) {
-      return (var) std::make_shared<Set>();
+      return (var) makeRef<Set>();
     }
 
     auto obj = params[0];
 
     // From None
     if (! obj) {
-      return (var) std::make_shared<Set>();
+      return (var) makeRef<Set>();
     }
 
     // From tuple
     {
-      if (auto tuple = std::dynamic_pointer_cast<Tuple>(obj)) {
-        const std::vector<var>& elements = tuple->getValue();
-        return (var) std::make_shared<Set>(
-          std::unordered_set<var>(elements.begin(), elements.end())
+      if (auto tuple = objectCast<Tuple>(obj)) {
+        const Sequence& elements = tuple->getValue();
+        return (var) makeRef<Set>(
+          SetStorage<var>(elements.begin(), elements.end())
         );
       }
     }
 
     // From list
     {
-      if (auto list = std::dynamic_pointer_cast<List>(obj)) {
-        const std::vector<var>& elements = list->getValue();
-        return (var) std::make_shared<Set>(
-          std::unordered_set<var>(elements.begin(), elements.end())
+      if (auto list = objectCast<List>(obj)) {
+        const Sequence& elements = list->getValue();
+        return (var) makeRef<Set>(
+          SetStorage<var>(elements.begin(), elements.end())
         );
       }
     }
 
     // From set
     {
-      if (auto set = std::dynamic_pointer_cast<Set>(obj)) {
-        const std::unordered_set<var>& elements = set->getValue();
+      if (auto set = objectCast<Set>(obj)) {
+        const SetStorage<var>& elements = set->getValue();
 
-        return (var) std::make_shared<Set>(elements);
+        return (var) makeRef<Set>(elements);
       }
     }
 
     // From dict
     {
-      if (auto map = std::dynamic_pointer_cast<Map>(obj)) {
-        const std::unordered_map<var, var>& elements = map->getValue();
+      if (auto map = objectCast<Map>(obj)) {
+        const Dict& elements = map->getValue();
         std::vector<var> keys;
 
         for (const auto& item: elements) {
           keys.push_back(item.first);
         }
 
-        return (var) std::make_shared<Set>(
-          std::unordered_set<var>(keys.begin(), keys.end())
+        return (var) makeRef<Set>(
+          SetStorage<var>(keys.begin(), keys.end())
+        );
+      }
+    }
+
+    // From dict keys, values or items
+    {
+      if (auto view = objectCast<MapView>(obj)) {
+        std::vector<var> elements = view->elements();
+        return (var) makeRef<Set>(
+          SetStorage<var>(elements.begin(), elements.end())
         );
       }
     }
 
-    std::cerr << "Unexpected type. Expected tuple, list, set or map.\n";
+    std::cerr << "Unexpected type. Expected tuple, list, set, map or map view.\n";
     return nullptr;
   }
 
-  var dict(const std::vector<ObjectPtr>& params) {
+  var dict(Args params) {
     if (params.size() > 1) {
       std::cerr << "dict: Invalid number of arguments\n";
       return nullptr;
     }
 
     if (params.empty()) {
-        return (var) std::make_shared<Map>();
+        return (var) makeRef<Map>();
     }
 
     auto obj = params[0];
 
     // From None
     if (! obj) {
-      return (var) std::make_shared<Map>();
+      return (var) makeRef<Map>();
     }
 
     // From dict
     {
-      if (auto map = std::dynamic_pointer_cast<Map>(obj)) {
-        return (var) std::make_shared<Map>(*map);
+      if (auto map = objectCast<Map>(obj)) {
+        return (var) makeRef<Map>(*map);
       }
     }
 
@@ -276,22 +309,22 @@ namespace Builtin {
 
     // From tuple
     if (! selectedPairs) {
-      if (auto tuple = std::dynamic_pointer_cast<Tuple>(obj)) {
+      if (auto tuple = objectCast<Tuple>(obj)) {
         selectedPairs = true;
 
         if (tuple->getValue().empty()) {
-          return (var) std::make_shared<Map>();
+          return (var) makeRef<Map>();
         }
 
         for (const var& item: tuple->getValue()) {
           std::vector<var> kv;
 
-          if (auto pairTuple = std::dynamic_pointer_cast<Tuple>(item.getValue())) {
-            kv = pairTuple->getValue();
-          } else if (auto pairList = std::dynamic_pointer_cast<List>(item.getValue())) {
-            kv = pairList->getValue();
-          } else if (auto pairSet = std::dynamic_pointer_cast<Set>(item.getValue())) {
-            const std::unordered_set<var>& elements = pairSet->getValue();
+          if (auto pairTuple = objectCast<Tuple>(item.getValue())) {
+            kv.assign(pairTuple->getValue().begin(), pairTuple->getValue().end());
+          } else if (auto pairList = objectCast<List>(item.getValue())) {
+            kv.assign(pairList->getValue().begin(), pairList->getValue().end());
+          } else if (auto pairSet = objectCast<Set>(item.getValue())) {
+            const SetStorage<var>& elements = pairSet->getValue();
             kv = std::vector<var>(elements.begin(), elements.end());
           } else {
             std::cerr << "dict: Only tuple of key-value pairs allowed.\n";
@@ -310,22 +343,22 @@ namespace Builtin {
 
     // From list
     if (! selectedPairs) {
-      if (auto list = std::dynamic_pointer_cast<List>(obj)) {
+      if (auto list = objectCast<List>(obj)) {
         selectedPairs = true;
 
         if (list->getValue().empty()) {
-          return (var) std::make_shared<Map>();
+          return (var) makeRef<Map>();
         }
 
         for (const var& item: list->getValue()) {
           std::vector<var> kv;
 
-          if (auto pairTuple = std::dynamic_pointer_cast<Tuple>(item.getValue())) {
-            kv = pairTuple->getValue();
-          } else if (auto pairList = std::dynamic_pointer_cast<List>(item.getValue())) {
-            kv = pairList->getValue();
-          } else if (auto pairSet = std::dynamic_pointer_cast<Set>(item.getValue())) {
-            const std::unordered_set<var>& elements = pairSet->getValue();
+          if (auto pairTuple = objectCast<Tuple>(item.getValue())) {
+            kv.assign(pairTuple->getValue().begin(), pairTuple->getValue().end());
+          } else if (auto pairList = objectCast<List>(item.getValue())) {
+            kv.assign(pairList->getValue().begin(), pairList->getValue().end());
+          } else if (auto pairSet = objectCast<Set>(item.getValue())) {
+            const SetStorage<var>& elements = pairSet->getValue();
             kv = std::vector<var>(elements.begin(), elements.end());
           } else {
             std::cerr << "dict: Only list of key-value pairs allowed.\n";
@@ -344,22 +377,22 @@ namespace Builtin {
 
     // From set
     if (! selectedPairs) {
-      if (auto set = std::dynamic_pointer_cast<Set>(obj)) {
+      if (auto set = objectCast<Set>(obj)) {
         selectedPairs = true;
 
         if (set->getValue().empty()) {
-          return (var) std::make_shared<Map>();
+          return (var) makeRef<Map>();
         }
 
         for (const var& item: set->getValue()) {
           std::vector<var> kv;
 
-          if (auto pairTuple = std::dynamic_pointer_cast<Tuple>(item.getValue())) {
-            kv = pairTuple->getValue();
-          } else if (auto pairList = std::dynamic_pointer_cast<List>(item.getValue())) {
-            kv = pairList->getValue();
-          } else if (auto pairSet = std::dynamic_pointer_cast<Set>(item.getValue())) {
-            const std::unordered_set<var>& elements = pairSet->getValue();
+          if (auto pairTuple = objectCast<Tuple>(item.getValue())) {
+            kv.assign(pairTuple->getValue().begin(), pairTuple->getValue().end());
+          } else if (auto pairList = objectCast<List>(item.getValue())) {
+            kv.assign(pairList->getValue().begin(), pairList->getValue().end());
+          } else if (auto pairSet = objectCast<Set>(item.getValue())) {
+            const SetStorage<var>& elements = pairSet->getValue();
             kv = std::vector<var>(elements.begin(), elements.end());
           } else {
             std::cerr << "dict: Only set of key-value pairs allowed.\n";
@@ -382,40 +415,40 @@ namespace Builtin {
       return nullptr;
     }
 
-    return (var) std::make_shared<Map>(pairs);
+    return (var) makeRef<Map>(pairs);
   }
 
-  var inlineTuple(const std::vector<ObjectPtr>& params) {
+  var inlineTuple(Args params) {
     std::vector<var> elements;
 
     for (const ObjectPtr& obj : params) {
       elements.push_back(obj);
     }
 
-    return (var) std::make_shared<Tuple>(elements);
+    return (var) makeRef<Tuple>(elements);
   }
 
-  var inlineList(const std::vector<ObjectPtr>& params) {
+  var inlineList(Args params) {
     std::vector<var> elements;
 
     for (const ObjectPtr& obj : params) {
       elements.push_back(obj);
     }
 
-    return (var) std::make_shared<List>(elements);
+    return (var) makeRef<List>(elements);
   }
 
-  var inlineSet(const std::vector<ObjectPtr>& params) {
-    std::unordered_set<var> elements;
+  var inlineSet(Args params) {
+    SetStorage<var> elements;
 
     for (const ObjectPtr& obj : params) {
       elements.insert(obj);
     }
 
-    return (var) std::make_shared<Set>(elements);
+    return (var) makeRef<Set>(elements);
   }
 
-  var inlineDict(const std::vector<Pair>& params) {
-    return (var) std::make_shared<Map>(params);
+  var inlineDict(std::initializer_list<Pair> params) {
+    return (var) makeRef<Map>(params);
   }
 }
@@ -3,48 +3,53 @@
 
 #include "../Object/var.hpp"
 #include "../Collections/Pair.hpp"
+#include "../Collections/Sequence.hpp"
 
 // Implement orphan built in functions
 namespace Builtin {
   // Get an iterator to the collection / container
-  var iter(const std::vector<ObjectPtr>& params);
+  var iter(Args params);
 
   // Get the next iterator in a sequence from another
-  var next(const std::vector<ObjectPtr>& params);
+  var next(Args params);
 
   // Get amount of elements in the collection / container
-  var len(const std::vector<ObjectPtr>& params);
+  var len(Args params);
 
   // Sum all of the elements in the collection / contaienr
-  var sum(const std::vector<ObjectPtr>& params);
+  var sum(Args params);
 
   // Get the lesser of the elements in the collection / contaienr
-  var min(const std::vector<ObjectPtr>& params);
+  var min(Args params);
 
   // Get the greatest of the elements in the collection / contaienr
-  var max(const std::vector<ObjectPtr>& params);
+  var max(Args params);
+
+  // New list with the elements of an iterable in ascending order, by the
+  // result of `key` on each when given
+  var sorted(const var& iterable, const Sequence::Key& key = Sequence::Key());
 
   // Construct a tuple
-  var tuple(const std::vector<ObjectPtr>& params);
+  var tuple(Args params);
 
   // Construct a list
-  var list(const std::vector<ObjectPtr>& params);
+  var list(Args params);
 
   // Construct a set
-  var set(const std::vector<ObjectPtr>& params);
+  var set(Args params);
 
   // Construct a map
-  var dict(const std::vector<ObjectPtr>& params);
+  var dict(Args params);
 
   // Construct a tuple from inline definition
-  var inlineTuple(const std::vector<ObjectPtr>& params);
+  var inlineTuple(Args params);
 
   // Construct a list from inline definition
-  var inlineList(const std::vector<ObjectPtr>& params);
+  var inlineList(Args params);
 
   // Construct a list from inline definition
-  var inlineSet(const std::vector<ObjectPtr>& params);
+  var inlineSet(Args params);
 
   // Construct a map from inline definition
-  var inlineDict(const std::vector<Pair>& params);
+  var inlineDict(std::initializer_list<Pair> params);
 }
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <utility>
 
 #include "../Object/object.hpp"
 #include "../Object/var.hpp"
@@ -13,20 +14,6 @@
 // Base template class containers of variables
 template <typename Derived, template <typename...> typename ContainerType>
 class Collection : public Object {
- private:
-
-  void init() {
-    _methods["pop"] = std::bind(&Collection::pop, this, std::placeholders::_1);
-    _methods["clear"] = std::bind(&Collection::clear, this, std::placeholders::_1);
-    _methods["remove"] = std::bind(&Collection::remove, this, std::placeholders::_1);
-    // _methods["slice"] = std::bind(&Collection::slice, this, std::placeholders::_1);
-    _methods["__len__"] = std::bind(&Collection::len, this, std::placeholders::_1);
-    _methods["__min__"] = std::bind(&Collection::min, this, std::placeholders::_1);
-    _methods["__max__"] = std::bind(&Collection::max, this, std::placeholders::_1);
-    _methods["__sum__"] = std::bind(&Collection::max, this, std::placeholders::_1);
-    _methods["__bool__"] = std::bind(&Collection::asBoolean, this, std::placeholders::_1);
-  }
- 
  protected:
   ContainerType<var> _elements;
 
@@ -43,11 +30,11 @@ class Collection : public Object {
 
  public:
   // Default constructor
-  Collection() { init(); }
+  Collection() : Object(Derived::tag) {}
 
   // Copy constructor
-  explicit Collection(const ContainerType<var>& elements) : _elements(elements) { init(); }
-  explicit Collection(const Collection<Derived, ContainerType>& other) : Object(other), _elements(other._elements) { init(); }
+  explicit Collection(ContainerType<var> elements) : Object(Derived::tag), _elements(std::move(elements)) {}
+  explicit Collection(const Collection<Derived, ContainerType>& other) : Object(other), _elements(other._elements) {}
   
   virtual ~Collection() override = default;
 
@@ -59,7 +46,7 @@ class Collection : public Object {
   virtual std::size_t hash() const override {
     std::size_t seed = std::size(_elements);
 
-    for (auto& i : _elements) {
+    for (const auto& i : _elements) {
         seed ^= i.hash() + 0x9e3779b9 + (seed << 6) + (seed >> 2);
     }
 
@@ -69,14 +56,28 @@ class Collection : public Object {
   virtual bool equals(const Object& other) const override {
     if (!isSameType(other)) { return false ;}
 
-    auto otherObj = dynamic_cast<const Collection<Derived, ContainerType>*>(&other);
+    auto otherObj = static_cast<const Collection<Derived, ContainerType>*>(&other);
     return this->_elements == otherObj->_elements;
   }
 
   // ------------------ Management Methods ------------------
 
+  // Methods shared by all collections
+  const MethodTable& getMethods() const override {
+    static const MethodTable methods = MethodTable()
+        .add(Methods::pop, &Collection::pop, true)
+        .add(Methods::clear, &Collection::clear, true)
+        .add(Methods::remove, &Collection::remove, true)
+        .add(Methods::len, &Collection::len)
+        .add(Methods::min, &Collection::min)
+        .add(Methods::max, &Collection::max)
+        .add(Methods::sum, &Collection::sum)
+        .add(Methods::asBoolean, &Collection::asBoolean);
+    return methods;
+  }
+
   // Remove specified element from collection
-  virtual Method::result_type remove(const std::vector<ObjectPtr>& params) {
+  virtual Method::result_type remove(Args params) {
     if (params.size() != 1) {
       throw std::runtime_error("remove: Invalid number of arguments");
     }
@@ -90,7 +91,7 @@ class Collection : public Object {
   }
 
   // Remove any element from collection
-  virtual Method::result_type pop(const std::vector<ObjectPtr>& params) {
+  virtual Method::result_type pop(Args params) {
     if (params.size() != 0) {
       throw std::runtime_error("pop: Invalid number of arguments");
     }
@@ -103,18 +104,18 @@ class Collection : public Object {
   }
 
   // Get a slice of the elements on the collection
-  // virtual Method::result_type slice(const std::vector<ObjectPtr>& params) {
+  // virtual Method::result_type slice(Args params) {
   //   return generalizedSlice(
   //     _elements,
   //     params,
   //     [&](ContainerType<var>& result, const var& element) { result.insert(_elements.end(), element); },
   //     [](const ContainerType<var>& resultContainer) {
-  //       return std::make_shared<Derived>(resultContainer);
+  //       return makeRef<Derived>(resultContainer);
   //     });
   // }
 
   // Remove all elements from collection
-  virtual Method::result_type clear(const std::vector<ObjectPtr>& params) {
+  virtual Method::result_type clear(Args params) {
     if (params.size() != 0) {
       throw std::runtime_error("clear: Invalid number of arguments");
     }
@@ -124,29 +125,36 @@ class Collection : public Object {
   }
 
   // Amount of elements in the collection
-  virtual Method::result_type len(const std::vector<ObjectPtr>& params) {
+  virtual Method::result_type len(Args params) {
     if (params.size() != 0) {
       throw std::runtime_error("__len__: Invalid number of arguments");
     }
 
-    return std::make_shared<Integer>(_elements.size());
+    return Integer::of(_elements.size());
   }
 
   // Returns true if collection is not empty
-  virtual Method::result_type asBoolean(const std::vector<ObjectPtr>& params) {
+  virtual Method::result_type asBoolean(Args params) {
     if (params.size() != 0) {
       throw std::runtime_error("__bool__: Invalid number of arguments");
     }
 
-    return std::make_shared<Boolean>(_elements.size() != 0);
+    return Boolean::of(_elements.size() != 0);
   }
 
   // Sum of all elements in the collection
-  virtual Method::result_type sum(const std::vector<ObjectPtr>& params) {
+  virtual Method::result_type sum(Args params) {
     if (params.size() != 0) {
       throw std::runtime_error("__sum__: Invalid number of arguments");
     }
 
+    // Sequences of unboxed numbers reduce them directly
+    if constexpr (requires { _elements.sum(); }) {
+      if (!_elements.isBoxed()) {
+        return _elements.sum().getValue();
+      }
+    }
+
     return var(
         std::accumulate(
             std::begin(_elements), std::end(_elements), (var) Integer(0)
@@ -155,11 +163,17 @@ class Collection : public Object {
   }
 
   // Return lesser element in the collection
-  virtual Method::result_type min(const std::vector<ObjectPtr>& params) {
+  virtual Method::result_type min(Args params) {
     if (params.size() != 0) {
       throw std::runtime_error("__min__: Invalid number of arguments");
     }
 
+    if constexpr (requires { _elements.min(); }) {
+      if (!_elements.isBoxed() && !_elements.empty()) {
+        return _elements.min().getValue();
+      }
+    }
+
     auto lesserSlot = std::min_element(std::begin(_elements), std::end(_elements));
     if (lesserSlot == _elements.end()) {
       return nullptr;
@@ -169,11 +183,17 @@ class Collection : public Object {
   }
 
   // Return greatest element in the collection
-  virtual Method::result_type max(const std::vector<ObjectPtr>& params) {
+  virtual Method::result_type max(Args params) {
     if (params.size() != 0) {
       throw std::runtime_error("__max__: Invalid number of arguments");
     }
 
+    if constexpr (requires { _elements.max(); }) {
+      if (!_elements.isBoxed() && !_elements.empty()) {
+        return _elements.max().getValue();
+      }
+    }
+
     auto greatestSlot = std::max_element(std::begin(_elements), std::end(_elements));
     if (greatestSlot == _elements.end()) {
         return nullptr;
@@ -209,12 +229,12 @@ class Collection : public Object {
     }
 
     ObjectIt clone() const override {
-      return std::make_shared<CollectionIterator>(*this);
+      return makeIterator<CollectionIterator>(*this);
     }
   };
 
   // Override iteration methods
   virtual ObjectIt getIterator() const override {
-    return std::make_shared<CollectionIterator>(*this);
+    return makeIterator<CollectionIterator>(*this);
   }
 };
\ No newline at end of file
@@ -0,0 +1,195 @@
+// Copyright (c) 2024 Syntax Errors.
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "../Object/var.hpp"
+#include "../Primitive/String.hpp"
+#include "../Primitive/StringKernels.hpp"
+#include "./List.hpp"
+#include "./Map.hpp"
+#include "./Pair.hpp"
+#include "./Set.hpp"
+#include "./Tuple.hpp"
+
+// Reference a loop holds to the object it walks. The loop does not count as
+// another owner, so the iterated variable changes that same object (and the
+// loop notices) instead of a copy of it
+class LoopPin {
+ private:
+  ObjectPtr object;
+
+ public:
+  LoopPin() = default;
+
+  explicit LoopPin(const ObjectPtr& iterable) : object(iterable) {
+    if (object) {
+      object->enterLoop();
+    }
+  }
+
+  LoopPin(const LoopPin& other) : LoopPin(other.object) {}
+
+  LoopPin& operator=(const LoopPin& other) {
+    LoopPin(other).object.swap(object);
+    return *this;
+  }
+
+  ~LoopPin() {
+    if (object) {
+      object->leaveLoop();
+    }
+  }
+};
+
+// Position of a range-based for loop over a var. Built-in containers are
+// walked in place without allocating; any other iterable goes through its
+// ObjectIterator
+class Cursor {
+ public:
+  enum class Mode : uint8_t { End, Sequence, String, Set, Map, Generic };
+
+ private:
+  Mode mode;
+  LoopPin pin;
+
+  // List and Tuple elements, or String characters, by position. The string
+  // holding the characters is kept alive, so appending to the iterated var
+  // builds a new string instead of growing this one. UTF-8 text moves by
+  // whole characters
+  std::size_t index = 0;
+  const Sequence* sequence = nullptr;
+  std::string_view text;
+  Ref<String> textOwner;
+  bool textUtf8 = false;
+
+  // Bytes of the character at the current position
+  inline std::size_t characterLength() const {
+    return textUtf8 ? StringKernels::sequenceLength(text[index]) : 1;
+  }
+
+  // Set and Map position, along with the version iteration started at
+  const Set* set = nullptr;
+  SetStorage<var>::const_iterator setIt;
+  SetStorage<var>::const_iterator setEnd;
+  std::size_t setVersion = 0;
+  const Map* map = nullptr;
+  Dict::const_iterator mapIt;
+  std::size_t mapVersion = 0;
+  Map::View mapView = Map::View::Items;
+
+  // Other iterables and the element they produced last
+  Object::ObjectIt generic;
+  var current;
+
+  inline void fetch() {
+    if (generic->hasNext()) {
+      current = var(generic->next());
+    } else {
+      mode = Mode::End;
+    }
+  }
+
+ public:
+  // End of any loop
+  Cursor() : mode(Mode::End) {}
+
+  explicit Cursor(const ObjectPtr& pointer) : pin(pointer) {
+    const Object& iterable = *pointer;
+    switch (iterable.type()) {
+      case TypeTag::List:
+        mode = Mode::Sequence;
+        sequence = &static_cast<const List&>(iterable).getValue();
+        break;
+      case TypeTag::Tuple:
+        mode = Mode::Sequence;
+        sequence = &static_cast<const Tuple&>(iterable).getValue();
+        break;
+      case TypeTag::String:
+        mode = Mode::String;
+        textOwner = static_cast<const String&>(iterable).buffer();
+        text = static_cast<const String&>(iterable).view();
+        textUtf8 = !static_cast<const String&>(iterable).indexesBytes();
+        break;
+      case TypeTag::Set:
+        mode = Mode::Set;
+        set = &static_cast<const Set&>(iterable);
+        setIt = set->getValue().begin();
+        setEnd = set->getValue().end();
+        setVersion = set->getVersion();
+        break;
+      case TypeTag::Map:
+        mode = Mode::Map;
+        map = &static_cast<const Map&>(iterable);
+        mapIt = map->getValue().begin();
+        mapVersion = map->getVersion();
+        break;
+      case TypeTag::MapView:
+        mode = Mode::Map;
+        map = &static_cast<const MapView&>(iterable).getMap();
+        mapIt = map->getValue().begin();
+        mapVersion = map->getVersion();
+        mapView = static_cast<const MapView&>(iterable).getView();
+        break;
+      default:
+        mode = Mode::Generic;
+        generic = iterable.getIterator();
+        fetch();
+        break;
+    }
+  }
+
+  // Whether the loop is over
+  inline bool done() const {
+    switch (mode) {
+      case Mode::Sequence: return index >= sequence->size();
+      case Mode::String: return index >= text.size();
+      case Mode::Set:
+        set->checkVersion(setVersion);
+        return setIt == setEnd;
+      case Mode::Map:
+        map->checkVersion(mapVersion);
+        return mapIt == map->getValue().end();
+      case Mode::Generic: return false;
+      default: return true;
+    }
+  }
+
+  // Current element, a copy sharing the stored object until either changes
+  inline var operator*() const {
+    switch (mode) {
+      case Mode::Sequence: return (*sequence)[index];
+      case Mode::String:
+        return var(textUtf8 ? String::of(text.substr(index, characterLength())) : String::of(text[index]));
+      case Mode::Set: return *setIt;
+      case Mode::Map: return Map::project(*mapIt, mapView);
+      case Mode::Generic: return current;
+      default: throw std::runtime_error("Dereferencing an invalid iterator");
+    }
+  }
+
+  inline Cursor& operator++() {
+    switch (mode) {
+      case Mode::Sequence: ++index; break;
+      case Mode::String: index += characterLength(); break;
+      case Mode::Set:
+        set->checkVersion(setVersion);
+        ++setIt;
+        break;
+      case Mode::Map:
+        map->checkVersion(mapVersion);
+        ++mapIt;
+        break;
+      case Mode::Generic: fetch(); break;
+      default: throw std::runtime_error("Incrementing an invalid iterator");
+    }
+    return *this;
+  }
+
+  // Loops only compare against the end cursor
+  inline bool operator!=(unused const Cursor& other) const {
+    return !done();
+  }
+};
@@ -0,0 +1,113 @@
+// Copyright (c) 2024 Syntax Errors.
+#include <algorithm>
+
+#include "./Dict.hpp"
+
+std::size_t Dict::freeSlot(std::size_t hash) const {
+  const std::size_t mask = slots.size() - 1;
+  std::size_t slot = hash & mask;
+  std::size_t perturb = hash;
+
+  while (slots[slot] >= 0) {
+    perturb >>= 5;
+    slot = (slot * 5 + perturb + 1) & mask;
+  }
+
+  return slot;
+}
+
+void Dict::resize(std::size_t capacity) {
+  // Keep the index at most two thirds full
+  std::size_t slotCount = minimumSlots;
+  while (slotCount * 2 < capacity * 3) {
+    slotCount *= 2;
+  }
+
+  if (used != entries.size()) {
+    std::vector<Entry> live;
+    live.reserve(std::max(capacity, used));
+    for (Entry& entry : entries) {
+      if (entry.first.getKind() != var::Kind::None) {
+        live.push_back(std::move(entry));
+      }
+    }
+    entries = std::move(live);
+  }
+
+  slots.assign(slotCount, emptySlot);
+  for (std::size_t position = 0; position < entries.size(); ++position) {
+    slots[freeSlot(entries[position].hash)] = static_cast<int32_t>(position);
+  }
+}
+
+void Dict::reserve(std::size_t capacity) {
+  if (slots.size() * 2 < capacity * 3) {
+    resize(capacity);
+  }
+  entries.reserve(capacity);
+}
+
+void Dict::clear() {
+  entries.clear();
+  slots.clear();
+  used = 0;
+}
+
+std::pair<Dict::iterator, bool> Dict::insert(const var& key, const var& value) {
+  const std::size_t hash = VarHash{}(key);
+
+  const std::size_t match = lookup(key, hash);
+  if (match != npos) {
+    return {iterator(entries.data() + slots[match], entries.data() + entries.size()), false};
+  }
+
+  // Holes count against the load factor until the next resize drops them
+  if ((entries.size() + 1) * 3 > slots.size() * 2) {
+    resize((used + 1) * 2);
+  }
+
+  slots[freeSlot(hash)] = static_cast<int32_t>(entries.size());
+  entries.push_back(Entry{hash, key, value});
+  ++used;
+
+  return {iterator(&entries.back(), entries.data() + entries.size()), true};
+}
+
+var& Dict::operator[](const var& key) {
+  return insert(key, var()).first->second;
+}
+
+Dict::iterator Dict::erase(const_iterator position) {
+  const std::size_t index = position.current - entries.data();
+  Entry& entry = entries[index];
+
+  const std::size_t mask = slots.size() - 1;
+  std::size_t slot = entry.hash & mask;
+  std::size_t perturb = entry.hash;
+  while (slots[slot] != static_cast<int32_t>(index)) {
+    perturb >>= 5;
+    slot = (slot * 5 + perturb + 1) & mask;
+  }
+
+  slots[slot] = removedSlot;
+  entry.first = var();
+  entry.second = var();
+  --used;
+
+  return iterator(entries.data() + index, entries.data() + entries.size());
+}
+
+bool Dict::operator==(const Dict& other) const {
+  if (used != other.used) {
+    return false;
+  }
+
+  for (const Entry& entry : *this) {
+    auto match = other.find(entry.first);
+    if (match == other.end() || !(match->second == entry.second)) {
+      return false;
+    }
+  }
+
+  return true;
+}
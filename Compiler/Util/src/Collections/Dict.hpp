@@ -0,0 +1,174 @@
+// Copyright (c) 2024 Syntax Errors.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "../Object/var.hpp"
+
+// Insertion-ordered hash table laid out like CPython 3.6+ dicts. Entries
+// are stored densely in insertion order along with their hash, and a sparse
+// index of slots maps hashes to entry positions by open addressing. Removed
+// entries leave a hole that is compacted away on the next resize
+class Dict {
+ public:
+  struct Entry {
+    std::size_t hash;
+    // None once the entry is removed
+    var first;
+    var second;
+  };
+
+  // Walks the live entries in insertion order
+  template <typename EntryType>
+  class Iterator {
+    friend class Dict;
+
+   private:
+    EntryType* current = nullptr;
+    EntryType* last = nullptr;
+
+    inline void skipHoles() {
+      while (current != last && current->first.getKind() == var::Kind::None) {
+        ++current;
+      }
+    }
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Entry;
+    using difference_type = std::ptrdiff_t;
+    using pointer = EntryType*;
+    using reference = EntryType&;
+
+    Iterator() = default;
+
+    Iterator(EntryType* current, EntryType* last) : current(current), last(last) { skipHoles(); }
+
+    // Mutable iterators convert to constant ones
+    inline operator Iterator<const Entry>() const { return Iterator<const Entry>(current, last); }
+
+    inline reference operator*() const { return *current; }
+
+    inline pointer operator->() const { return current; }
+
+    inline Iterator& operator++() {
+      ++current;
+      skipHoles();
+      return *this;
+    }
+
+    inline Iterator operator++(int) {
+      Iterator previous = *this;
+      ++(*this);
+      return previous;
+    }
+
+    inline bool operator==(const Iterator& other) const { return current == other.current; }
+  };
+
+  using iterator = Iterator<Entry>;
+  using const_iterator = Iterator<const Entry>;
+
+ private:
+  // Slot markers, any other value is the position of an entry
+  static constexpr int32_t emptySlot = -1;
+  static constexpr int32_t removedSlot = -2;
+  static constexpr std::size_t minimumSlots = 8;
+
+  std::vector<Entry> entries;
+  std::vector<int32_t> slots;
+  // Live entries, excluding holes
+  std::size_t used = 0;
+
+  // Slot holding the entry for a key, or npos
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+  template <typename Key>
+  std::size_t lookup(const Key& key, std::size_t hash) const {
+    if (slots.empty()) {
+      return npos;
+    }
+
+    const std::size_t mask = slots.size() - 1;
+    std::size_t slot = hash & mask;
+    std::size_t perturb = hash;
+
+    while (true) {
+      const int32_t position = slots[slot];
+      if (position == emptySlot) {
+        return npos;
+      }
+      if (position >= 0) {
+        const Entry& entry = entries[position];
+        if (entry.hash == hash && VarEqual{}(entry.first, key)) {
+          return slot;
+        }
+      }
+
+      perturb >>= 5;
+      slot = (slot * 5 + perturb + 1) & mask;
+    }
+  }
+
+  // First reusable slot for a hash known to be absent
+  std::size_t freeSlot(std::size_t hash) const;
+
+  // Rebuild the index for at least `capacity` entries, dropping holes
+  void resize(std::size_t capacity);
+
+  template <typename Key>
+  inline const_iterator locate(const Key& key) const {
+    const std::size_t slot = lookup(key, VarHash{}(key));
+    return slot == npos ? end() : at(slots[slot]);
+  }
+
+  inline const_iterator at(std::size_t position) const {
+    return const_iterator(entries.data() + position, entries.data() + entries.size());
+  }
+
+ public:
+  Dict() = default;
+
+  inline std::size_t size() const { return used; }
+
+  inline bool empty() const { return used == 0; }
+
+  // Make room for `capacity` entries without resizing the index
+  void reserve(std::size_t capacity);
+
+  void clear();
+
+  // Add an entry unless the key is present, like std::unordered_map::insert
+  std::pair<iterator, bool> insert(const var& key, const var& value);
+
+  // Value for a key, inserting None if absent
+  var& operator[](const var& key);
+
+  // Entry for a key, given as a var or a borrowed Object
+  template <typename Key>
+  inline const_iterator find(const Key& key) const { return locate(key); }
+
+  template <typename Key>
+  inline iterator find(const Key& key) {
+    const_iterator match = locate(key);
+    return iterator(const_cast<Entry*>(match.current), entries.data() + entries.size());
+  }
+
+  // Remove an entry, returns the one following it
+  iterator erase(const_iterator position);
+
+  inline iterator begin() { return iterator(entries.data(), entries.data() + entries.size()); }
+
+  inline iterator end() { return iterator(entries.data() + entries.size(), entries.data() + entries.size()); }
+
+  inline const_iterator begin() const { return at(0); }
+
+  inline const_iterator end() const { return at(entries.size()); }
+
+  // Same keys mapped to equal values, regardless of order
+  bool operator==(const Dict& other) const;
+};
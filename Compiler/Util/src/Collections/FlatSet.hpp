@@ -0,0 +1,303 @@
+// Copyright (c) 2024 Syntax Errors.
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "../Object/var.hpp"
+
+// Open-addressing hash set in the style of Swiss tables. Elements are stored
+// inline next to their hash, and a parallel array of control bytes (empty,
+// deleted, or 7 bits of the hash) is probed a group of 16 slots at a time
+template <typename T, typename Hash = VarHash, typename Equal = VarEqual>
+class FlatSet {
+ private:
+  struct Slot {
+    std::size_t hash;
+    T value;
+  };
+
+  static constexpr std::size_t groupWidth = 16;
+  static constexpr std::size_t minimumCapacity = 16;
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+  // Control bytes of free slots have the sign bit set, full ones keep 7 hash bits
+  static constexpr int8_t emptyControl = -128;
+  static constexpr int8_t deletedControl = -2;
+
+  // One control byte per slot, plus a copy of the first group at the end so
+  // groups can be loaded past the last slot without wrapping
+  std::vector<int8_t> controls;
+  std::vector<Slot> slots;
+  std::size_t count = 0;
+  std::size_t tombstones = 0;
+
+  // Bumped whenever elements are inserted or removed, invalidating iteration
+  std::size_t changes = 0;
+
+  // Spread the low-entropy hashes of numbers (identity for integers) over all bits
+  static inline std::size_t mix(std::size_t hash) {
+    uint64_t bits = hash;
+    bits ^= bits >> 33;
+    bits *= 0xff51afd7ed558ccdULL;
+    bits ^= bits >> 33;
+    return static_cast<std::size_t>(bits);
+  }
+
+  static inline int8_t control(std::size_t hash) { return static_cast<int8_t>(hash & 0x7F); }
+
+  inline std::size_t capacity() const { return slots.size(); }
+
+  // Positions in the group at `offset` whose control byte equals `value`
+  inline uint32_t matchGroup(std::size_t offset, int8_t value) const {
+#ifdef __SSE2__
+    __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(controls.data() + offset));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(value))));
+#else
+    uint32_t mask = 0;
+    for (std::size_t index = 0; index < groupWidth; ++index) {
+      mask |= static_cast<uint32_t>(controls[offset + index] == value) << index;
+    }
+    return mask;
+#endif
+  }
+
+  // Positions in the group at `offset` that are empty or deleted
+  inline uint32_t matchFree(std::size_t offset) const {
+#ifdef __SSE2__
+    __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(controls.data() + offset));
+    return static_cast<uint32_t>(_mm_movemask_epi8(group));
+#else
+    uint32_t mask = 0;
+    for (std::size_t index = 0; index < groupWidth; ++index) {
+      mask |= static_cast<uint32_t>(controls[offset + index] < 0) << index;
+    }
+    return mask;
+#endif
+  }
+
+  inline void setControl(std::size_t index, int8_t value) {
+    controls[index] = value;
+    if (index < groupWidth) {
+      controls[capacity() + index] = value;
+    }
+  }
+
+  // Slot holding a key with the given (mixed) hash, or npos
+  template <typename Key>
+  std::size_t locate(const Key& key, std::size_t hash) const {
+    if (slots.empty()) {
+      return npos;
+    }
+
+    const std::size_t mask = capacity() - 1;
+    std::size_t offset = (hash >> 7) & mask;
+
+    for (std::size_t step = groupWidth; ; step += groupWidth) {
+      for (uint32_t bits = matchGroup(offset, control(hash)); bits; bits &= bits - 1) {
+        const std::size_t index = (offset + std::countr_zero(bits)) & mask;
+        if (slots[index].hash == hash && Equal{}(slots[index].value, key)) {
+          return index;
+        }
+      }
+
+      if (matchGroup(offset, emptyControl)) {
+        return npos;
+      }
+      offset = (offset + step) & mask;
+    }
+  }
+
+  // First empty or deleted slot along the probe sequence of a hash
+  std::size_t freeSlot(std::size_t hash) const {
+    const std::size_t mask = capacity() - 1;
+    std::size_t offset = (hash >> 7) & mask;
+
+    for (std::size_t step = groupWidth; ; step += groupWidth) {
+      if (uint32_t bits = matchFree(offset)) {
+        return (offset + std::countr_zero(bits)) & mask;
+      }
+      offset = (offset + step) & mask;
+    }
+  }
+
+  // Rebuild with room for `needed` elements, dropping tombstones
+  void rehash(std::size_t needed) {
+    std::size_t newCapacity = minimumCapacity;
+    while (newCapacity * 7 < needed * 8) {
+      newCapacity *= 2;
+    }
+
+    std::vector<Slot> previous = std::move(slots);
+    std::vector<int8_t> previousControls = std::move(controls);
+
+    slots.assign(newCapacity, Slot{});
+    controls.assign(newCapacity + groupWidth, emptyControl);
+    tombstones = 0;
+
+    for (std::size_t index = 0; index < previous.size(); ++index) {
+      if (previousControls[index] >= 0) {
+        const std::size_t target = freeSlot(previous[index].hash);
+        setControl(target, previousControls[index]);
+        slots[target] = std::move(previous[index]);
+      }
+    }
+  }
+
+ public:
+  // Visits full slots in table order
+  class const_iterator {
+    friend class FlatSet;
+
+   private:
+    const FlatSet* set = nullptr;
+    std::size_t index = 0;
+
+    inline void skipFree() {
+      while (index < set->capacity() && set->controls[index] < 0) {
+        ++index;
+      }
+    }
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    const_iterator() = default;
+
+    const_iterator(const FlatSet* set, std::size_t index) : set(set), index(index) { skipFree(); }
+
+    inline reference operator*() const { return set->slots[index].value; }
+
+    inline pointer operator->() const { return &set->slots[index].value; }
+
+    inline const_iterator& operator++() {
+      ++index;
+      skipFree();
+      return *this;
+    }
+
+    inline const_iterator operator++(int) {
+      const_iterator previous = *this;
+      ++(*this);
+      return previous;
+    }
+
+    inline bool operator==(const const_iterator& other) const { return index == other.index; }
+  };
+
+  // Elements are immutable once stored
+  using iterator = const_iterator;
+  using value_type = T;
+
+  FlatSet() = default;
+
+  template <typename InputIt>
+  FlatSet(InputIt first, InputIt last) { insert(first, last); }
+
+  inline std::size_t size() const { return count; }
+
+  inline bool empty() const { return count == 0; }
+
+  inline std::size_t version() const { return changes; }
+
+  inline const_iterator begin() const { return const_iterator(this, 0); }
+
+  inline const_iterator end() const { return const_iterator(this, capacity()); }
+
+  // Make room for `needed` elements without rehashing
+  void reserve(std::size_t needed) {
+    if ((needed + tombstones) * 8 > capacity() * 7) {
+      rehash(needed);
+    }
+  }
+
+  void clear() {
+    controls.clear();
+    slots.clear();
+    count = 0;
+    tombstones = 0;
+    ++changes;
+  }
+
+  std::pair<const_iterator, bool> insert(const T& value) {
+    const std::size_t hash = mix(Hash{}(value));
+
+    const std::size_t match = locate(value, hash);
+    if (match != npos) {
+      return {const_iterator(this, match), false};
+    }
+
+    // Keep at least one empty slot per probe sequence, growing once 7/8 full
+    if ((count + tombstones + 1) * 8 > capacity() * 7) {
+      rehash((count + 1) * 2);
+    }
+
+    const std::size_t index = freeSlot(hash);
+    if (controls[index] == deletedControl) {
+      --tombstones;
+    }
+    setControl(index, control(hash));
+    slots[index] = Slot{hash, value};
+    ++count;
+    ++changes;
+
+    return {const_iterator(this, index), true};
+  }
+
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+      insert(*first);
+    }
+  }
+
+  // Element equal to a key, given as a T or any type Hash and Equal accept
+  template <typename Key>
+  inline const_iterator find(const Key& key) const {
+    const std::size_t index = locate(key, mix(Hash{}(key)));
+    return index == npos ? end() : const_iterator(this, index);
+  }
+
+  template <typename Key>
+  inline bool contains(const Key& key) const {
+    return locate(key, mix(Hash{}(key))) != npos;
+  }
+
+  // Remove an element, returns the one following it
+  const_iterator erase(const_iterator position) {
+    setControl(position.index, deletedControl);
+    slots[position.index].value = T();
+    --count;
+    ++tombstones;
+    ++changes;
+
+    return const_iterator(this, position.index);
+  }
+
+  // Same elements, regardless of order
+  bool operator==(const FlatSet& other) const {
+    if (count != other.count) {
+      return false;
+    }
+
+    for (const T& element : *this) {
+      if (!other.contains(element)) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+};
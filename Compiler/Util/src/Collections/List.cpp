@@ -1,23 +1,15 @@
 // Copyright (c) 2024 Syntax Errors.
 #include "List.hpp"
-
-// ------------------ Private methods ------------------
-
-void List::init() {
-  _methods["append"] = std::bind(&List::append, this, std::placeholders::_1);
-  _methods["insert"] = std::bind(&List::insert, this, std::placeholders::_1);
-  _methods["index"] = std::bind(&List::index, this, std::placeholders::_1);
-  _methods["slice"] = std::bind(&List::slice, this, std::placeholders::_1);
-  _methods["__str__"] = std::bind(&List::asString, this, std::placeholders::_1);
-}
+#include "Tuple.hpp"
+#include "Cursor.hpp"
 
 // ------------------ Constructors and destructor ------------------
 
-List::List() { init(); }
+List::List() {}
 
-List::List(const List& other) : Collection<List, std::vector>(other) { init(); }
+List::List(const List& other) : Collection<List, SequenceStorage>(other) {}
 
-List::List(const std::vector<var>& elements) : Collection<List, std::vector>(elements) { init(); }
+List::List(Sequence elements) : Collection<List, SequenceStorage>(std::move(elements)) {}
 
 List::~List() = default;
 
@@ -35,42 +27,37 @@ void List::print(std::ostream& os) const {
 }
 
 ObjectPtr List::clone() const {
-  return std::make_shared<List>(*this);
+  return makeRef<List>(*this);
 }
 
 List::operator ObjectPtr() {
-  return std::make_shared<List>(*this);
+  return makeRef<List>(*this);
 }
 
 bool List::equals(const Object& other) const {
-  auto otherList = dynamic_cast<const List*>(&other);
+  auto otherList = objectCast<List>(&other);
   return otherList && _elements == otherList->_elements;
 }
 
-bool List::less(const Object& other) const {
-  auto otherList = dynamic_cast<const List*>(&other);
-  return otherList && _elements < otherList->_elements;
-}
-
-bool List::greater(const Object& other) const {
-  auto otherList = dynamic_cast<const List*>(&other);
-  return otherList && _elements > otherList->_elements;
+std::partial_ordering List::compare(const Object& other) const {
+  auto otherList = objectCast<List>(&other);
+  return otherList ? _elements.compare(otherList->_elements) : std::partial_ordering::unordered;
 }
 
 ObjectPtr List::add(const Object& other) const {
-  auto otherList = dynamic_cast<const List*>(&other);
+  auto otherList = objectCast<List>(&other);
   if (!otherList) {
     std::cerr << "Invalid argument type, expected List.\n";
     return nullptr;
   }
 
-  std::vector<var> result = _elements;
-  result.insert(result.end(), otherList->_elements.begin(), otherList->_elements.end());
-  return std::make_shared<List>(result);
+  Sequence result = _elements;
+  result.append(otherList->_elements);
+  return makeRef<List>(std::move(result));
 }
 
 ObjectPtr List::subscript(const Object& other) const {
-  auto otherObj = dynamic_cast<const Integer*>(&other);
+  auto otherObj = objectCast<Integer>(&other);
   if (!otherObj) {
     std::cerr << "Invalid index type, expected Integer.\n";
     return nullptr;
@@ -85,24 +72,73 @@ ObjectPtr List::subscript(const Object& other) const {
   return _elements[index].getValue();
 }
 
+var* List::slot(const Object& other) {
+  auto otherObj = objectCast<Integer>(&other);
+  if (!otherObj) {
+    return nullptr;
+  }
+
+  std::size_t index = normalizeIndex(otherObj->getValue());
+  return index < _elements.size() ? _elements.slot(index) : nullptr;
+}
+
 // ------------------ Management methods ------------------
 
-ObjectPtr List::append(const std::vector<ObjectPtr>& params) {
+const MethodTable& List::getMethods() const {
+  static const MethodTable methods = MethodTable(Collection::getMethods())
+      .add(Methods::append, &List::append, true)
+      .add(Methods::extend, &List::extend, true)
+      .add(Methods::insert, &List::insert, true)
+      .add(Methods::index, &List::index)
+      .add(Methods::has, &List::has)
+      .add(Methods::sort, &List::sort, true)
+      .add(Methods::slice, &List::slice)
+      .add(Methods::asString, &List::asString);
+  return methods;
+}
+
+ObjectPtr List::append(Args params) {
   if (params.size() != 1) {
     throw std::runtime_error("append: Invalid number of arguments");
   }
 
   ObjectPtr element = params[0];
-  if (element) _elements.push_back(element->clone());
+  if (element) _elements.push_back(element);
   return nullptr;
 }
 
-ObjectPtr List::insert(const std::vector<ObjectPtr>& params) {
+ObjectPtr List::extend(Args params) {
+  if (params.size() != 1) {
+    throw std::runtime_error("extend: Invalid number of arguments");
+  }
+
+  if (!params[0]) {
+    throw std::runtime_error("extend: Argument must be iterable");
+  }
+
+  const Object& other = *params[0];
+  if (other.type() == TypeTag::List) {
+    _elements.append(static_cast<const List&>(other)._elements);
+    return nullptr;
+  }
+  if (other.type() == TypeTag::Tuple) {
+    _elements.append(static_cast<const Tuple&>(other).getValue());
+    return nullptr;
+  }
+
+  var iterable = params[0];
+  for (const var& item : iterable) {
+    _elements.push_back(item);
+  }
+  return nullptr;
+}
+
+ObjectPtr List::insert(Args params) {
   if (params.size() != 2) {
     throw std::runtime_error("insert: Invalid number of arguments");
   }
 
-  const Integer* pos = dynamic_cast<const Integer*>(params[0].get());
+  const Integer* pos = objectCast<Integer>(params[0].get());
   if (!pos) {
     std::cerr << "insert: Non-integer index\n";
     return nullptr;
@@ -113,34 +149,58 @@ ObjectPtr List::insert(const std::vector<ObjectPtr>& params) {
   return nullptr;
 }
 
-ObjectPtr List::index(const std::vector<ObjectPtr>& params) {
+ObjectPtr List::index(Args params) {
   if (params.size() != 1) {
     throw std::runtime_error("index: Invalid number of arguments");
   }
 
-  var query = params[0];
-  for (size_t i = 0; i < _elements.size(); ++i) {
-    if (_elements[i] == query) {
-      return std::make_shared<Integer>(i);
-    }
+  std::size_t position = _elements.find(var(params[0]));
+  if (position != Sequence::npos) {
+    return Integer::of(position);
   }
 
   std::cerr << "index: Value missing from list\n";
   return nullptr;
 }
 
-ObjectPtr List::slice(const std::vector<ObjectPtr>& params) {
+ObjectPtr List::has(Args params) {
+  if (params.size() != 1) {
+    throw std::runtime_error("has: Invalid number of arguments");
+  }
+
+  return Boolean::of(_elements.find(var(params[0])) != Sequence::npos);
+}
+
+ObjectPtr List::sort(Args params) {
+  if (params.size() != 0) {
+    throw std::runtime_error("sort: Invalid number of arguments");
+  }
+
+  _elements.sort();
+  return nullptr;
+}
+
+void List::sortBy(const Sequence::Key& key) {
+  _elements.sort(key);
+}
+
+ObjectPtr List::slice(Args params) {
+  SliceBounds bounds = sliceBounds(_elements.size(), params);
+  if (bounds.step == 1) {
+    return makeRef<List>(_elements.slice(bounds.start, bounds.end));
+  }
+
   return generalizedSlice(
     _elements,
     params,
-    [](std::vector<var>& result, const var& element) { result.push_back(element); },
-    [](const std::vector<var>& resultContainer) {
-      return std::make_shared<List>(resultContainer);
+    [](Sequence& result, const var& element) { result.push_back(element); },
+    [](Sequence& resultContainer) {
+      return makeRef<List>(std::move(resultContainer));
     });
 }
 
 // Get string representation of list
-Object::Method::result_type List::asString(const std::vector<ObjectPtr>& params) {
+Object::Method::result_type List::asString(Args params) {
   if (params.size() != 0) {
     throw std::runtime_error("__str__: Invalid number of arguments");
   }
@@ -150,11 +210,11 @@ Object::Method::result_type List::asString(const std::vector<ObjectPtr>& params)
   
   for (auto it = _elements.begin(); it != _elements.end(); ++it) {
     if (
-      auto stringPtr = std::dynamic_pointer_cast<String>(
-        (*it)->Call("__str__", {})
+      auto stringPtr = objectCast<String>(
+        (*it)->Call(Methods::asString, {})
       )
     ) {
-      result.append(stringPtr->getValue());
+      result.append(stringPtr->view());
       
       if (std::next(it) != _elements.end()) {
         result.append(", ");
@@ -164,5 +224,5 @@ Object::Method::result_type List::asString(const std::vector<ObjectPtr>& params)
 
   result.append("]");
 
-  return std::make_shared<String>(result);
+  return makeRef<String>(result);
 }
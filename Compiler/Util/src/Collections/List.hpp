@@ -1,54 +1,65 @@
-// Copyright (c) 2024 Syntax Errors.
-#pragma once
-
-#include <memory>
-#include <tuple>
-#include <utility>
-#include <vector>
-
-#include "./Collection.hpp"
-#include "../functions.hpp"
-
-class List : public Collection<List, std::vector> {
- private:
-  void init();
-
- public:
-  // ------------------ Constructors and destructor -----------------
-
-  // Default constructor
-  List();
-  // Copy constructor
-  List(const List& other);
-  explicit List(const std::vector<var>& elements);
-  // Destructor
-  ~List() override;
-
-  // ------------------ Native overrides -----------------
-  // Print list contents
-  void print(std::ostream& os) const override;
-  // Clone self
-  ObjectPtr clone() const override;
-
-  // ------------------ Native operators ------------------
-
-  operator ObjectPtr() override;
-  bool equals(const Object& other) const override;
-  bool less(const Object& other) const override;
-  bool greater(const Object& other) const override;
-  ObjectPtr add(const Object& other) const override;
-  ObjectPtr subscript(const Object& other) const override;
-
-  // ------------------ Management methods ------------------
-
-  // Add element to end of list
-  Method::result_type append(const std::vector<ObjectPtr>& params);
-  // Insert element on given index
-  Method::result_type insert(const std::vector<ObjectPtr>& params);
-  // Return index of first ocurrence of element
-  Method::result_type index(const std::vector<ObjectPtr>& params);
-  // Return sliced list
-  Method::result_type slice(const std::vector<ObjectPtr>& params);
-  // Get string representation of set
-  Method::result_type asString(const std::vector<ObjectPtr>& params);
-};
+// Copyright (c) 2024 Syntax Errors.
+#pragma once
+
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "./Collection.hpp"
+#include "./Sequence.hpp"
+#include "../functions.hpp"
+
+class List : public Collection<List, SequenceStorage> {
+ public:
+  static constexpr TypeTag tag = TypeTag::List;
+
+  // ------------------ Constructors and destructor -----------------
+
+  // Default constructor
+  List();
+  // Copy constructor
+  List(const List& other);
+  explicit List(Sequence elements);
+  // Destructor
+  ~List() override;
+
+  // ------------------ Native overrides -----------------
+  // Print list contents
+  void print(std::ostream& os) const override;
+  // Clone self
+  ObjectPtr clone() const override;
+
+  // ------------------ Native operators ------------------
+
+  operator ObjectPtr() override;
+  bool equals(const Object& other) const override;
+  std::partial_ordering compare(const Object& other) const override;
+  ObjectPtr add(const Object& other) const override;
+  ObjectPtr subscript(const Object& other) const override;
+  var* slot(const Object& other) override;
+
+  // ------------------ Management methods ------------------
+
+  // Methods supported by lists
+  const MethodTable& getMethods() const override;
+  // Add element to end of list
+  Method::result_type append(Args params);
+
+  // Append every element of an iterable
+  Method::result_type extend(Args params);
+  // Insert element on given index
+  Method::result_type insert(Args params);
+  // Return index of first ocurrence of element
+  Method::result_type index(Args params);
+  // Whether an element is in the list
+  Method::result_type has(Args params);
+  // Sort elements in place
+  Method::result_type sort(Args params);
+  // Sort elements in place by a key of each one
+  void sortBy(const Sequence::Key& key);
+  // Return sliced list
+  Method::result_type slice(Args params);
+  // Get string representation of set
+  Method::result_type asString(Args params);
+};
@@ -1,55 +1,49 @@
 // Copyright (c) 2024 Syntax Errors.
-#include "./Map.hpp"
+#include <sstream>
 
-// ------------------ Private methods ------------------
-void Map::init() {
-  _methods["keys"] = std::bind(&Map::keys, this, std::placeholders::_1);
-  _methods["values"] = std::bind(&Map::values, this, std::placeholders::_1);
-  _methods["items"] = std::bind(&Map::items, this, std::placeholders::_1);
-  _methods["addElement"] = std::bind(&Map::addElement, this, std::placeholders::_1);
-  _methods["pop"] = std::bind(&Map::pop, this, std::placeholders::_1);
-  _methods["clear"] = std::bind(&Map::clear, this, std::placeholders::_1);
-  _methods["get"] = std::bind(&Map::get, this, std::placeholders::_1);
-  _methods["slice"] = std::bind(&Map::slice, this, std::placeholders::_1);
-  _methods["__len__"] = std::bind(&Map::len, this, std::placeholders::_1);
-  _methods["__min__"] = std::bind(&Map::min, this, std::placeholders::_1);
-  _methods["__max__"] = std::bind(&Map::max, this, std::placeholders::_1);
-  _methods["__sum__"] = std::bind(&Map::sum, this, std::placeholders::_1);
-  _methods["__str__"] = std::bind(&Map::asString, this, std::placeholders::_1);
-  _methods["__bool__"] = std::bind(&Map::asBoolean, this, std::placeholders::_1);
-}
+#include "./Map.hpp"
 
 // ------------------ Constructors and destructor ------------------
-Map::Map() : elements() { init(); }
+Map::Map() : Object(tag), elements() {}
 
-Map::Map(const Map& other) : Object(other), elements(other.elements) {
-  this->init();
-}
+Map::Map(const Map& other) : Object(other), elements(other.elements) {}
 
-Map::Map(const std::vector<Pair>& pairs) {
+Map::Map(const std::vector<Pair>& pairs) : Object(tag) {
+  elements.reserve(pairs.size());
   for (const Pair& pair : pairs) {
     elements[pair.getFirst()] = pair.getSecond();
   }
 } 
 
+Map::Map(std::initializer_list<Pair> pairs) : Object(tag) {
+  elements.reserve(pairs.size());
+  for (const Pair& pair : pairs) {
+    elements[pair.getFirst()] = pair.getSecond();
+  }
+}
+
 // ------------------ Native overrides ------------------
 
 ObjectPtr Map::add(unused const Object& other) const {
-  return std::make_shared<Map>(*this);
+  return makeRef<Map>(*this);
 }
 
 ObjectPtr Map::subscript(const Object& other) const {
-  for (const auto& kv : this->elements) {
-    if (kv.first->equals(other)) {
-      return kv.second.getValue();
-    }
+  auto it = elements.find(other);
+  if (it != elements.end()) {
+    return it->second.getValue();
   }
   std::cerr << "Key not found\n";
   return nullptr;
 }
 
+var* Map::slot(const Object& other) {
+  auto it = elements.find(other);
+  return it != elements.end() ? &it->second : nullptr;
+}
+
 bool Map::equals(const Object& other) const {
-  auto otherMap = dynamic_cast<const Map*>(&other);
+  auto otherMap = objectCast<Map>(&other);
   if (!otherMap) {
     throw std::invalid_argument("Cannot compare map with given type");
   }
@@ -68,10 +62,28 @@ void Map::print(std::ostream& os) const {
 }
 
 ObjectPtr Map::clone() const {
-  return std::make_shared<Map>(*this);
+  return makeRef<Map>(*this);
 }
 
-const std::unordered_map<var, var>& Map::getValue() { return elements; }
+const Dict& Map::getValue() const { return elements; }
+
+var Map::project(const Entry& entry, View view) {
+  switch (view) {
+    case View::Keys: return entry.first;
+    case View::Values: return entry.second;
+    default: return var(Pair(entry.first, entry.second));
+  }
+}
+
+Dict::const_iterator Map::find(const ObjectPtr& key) const {
+  return key ? elements.find(*key) : elements.end();
+}
+
+void Map::checkVersion(std::size_t expectedVersion) const {
+  if (version != expectedVersion) {
+    throw std::runtime_error("Map changed size during iteration");
+  }
+}
 
 // ------------------ Native operators ------------------
 
@@ -94,9 +106,29 @@ Map Map::operator+(const Map& other) const {
 }
 
 // ------------------ Management Methods ------------------
-using Method = std::function<ObjectPtr(const std::vector<ObjectPtr>&)>;
+using Method = std::function<ObjectPtr(Args)>;
+
+const MethodTable& Map::getMethods() const {
+  static const MethodTable methods = MethodTable()
+      .add(Methods::keys, &Map::keys)
+      .add(Methods::values, &Map::values)
+      .add(Methods::items, &Map::items)
+      .add(Methods::addElement, &Map::addElement, true)
+      .add(Methods::pop, &Map::pop, true)
+      .add(Methods::clear, &Map::clear, true)
+      .add(Methods::get, &Map::get)
+      .add(Methods::has, &Map::has)
+      .add(Methods::slice, &Map::slice)
+      .add(Methods::len, &Map::len)
+      .add(Methods::min, &Map::min)
+      .add(Methods::max, &Map::max)
+      .add(Methods::sum, &Map::sum)
+      .add(Methods::asString, &Map::asString)
+      .add(Methods::asBoolean, &Map::asBoolean);
+  return methods;
+}
 
-Method::result_type Map::addElement(const std::vector<ObjectPtr>& params) {
+Method::result_type Map::addElement(Args params) {
   if (params.size() != 2) {
     throw std::runtime_error("addElement: Invalid number of arguments");
   }
@@ -108,25 +140,24 @@ Method::result_type Map::addElement(const std::vector<ObjectPtr>& params) {
     throw std::runtime_error("Map: cannot add null key");
   }
 
-  auto it = this->elements.find(key);
-  if (it == this->elements.end()) {
-    this->elements.insert({key, value});
+  if (this->elements.insert(key, value).second) {
+    ++version;
   }
 
   return nullptr;
 }
 
-Method::result_type Map::pop(const std::vector<ObjectPtr>& params) {
+Method::result_type Map::pop(Args params) {
   if (params.size() != 1) {
     throw std::runtime_error("pop: Invalid number of arguments");
   }
 
-  var key = params[0];
-  auto it = elements.find(key);
+  auto it = find(params[0]);
 
   if (it != elements.end()) {
     var removedElement = it->second;
     elements.erase(it);
+    ++version;
     return removedElement.getValue();
   } else {
     std::cerr << "Key not found\n";
@@ -134,12 +165,13 @@ Method::result_type Map::pop(const std::vector<ObjectPtr>& params) {
   }
 }
 
-Method::result_type Map::clear(const std::vector<ObjectPtr>& params) {
+Method::result_type Map::clear(Args params) {
   if (params.size() != 0) {
     throw std::runtime_error("clear: Invalid number of arguments");
   }
 
   elements.clear();
+  ++version;
   return nullptr;
 }
 
@@ -147,60 +179,54 @@ size_t Map::size() const {
   return elements.size();
 }
 
-Method::result_type Map::keys(const std::vector<ObjectPtr>& params) {
+Method::result_type Map::keys(Args params) {
   if (params.size() != 0) {
     throw std::runtime_error("keys: Invalid number of arguments");
   }
 
-  std::vector<var> keyList;
-  for (const auto& kv : elements) {
-    keyList.push_back(kv.first);
-  }
-  return std::make_shared<List>(keyList);
+  return makeRef<MapView>(Ref<Map>(this), View::Keys);
 }
 
-Method::result_type Map::values(const std::vector<ObjectPtr>& params) {
+Method::result_type Map::values(Args params) {
   if (params.size() != 0) {
     throw std::runtime_error("values: Invalid number of arguments");
   }
 
-  std::vector<var> valueList;
-  for (const auto& kv : elements) {
-    valueList.push_back(kv.second);
-  }
-  return std::make_shared<List>(valueList);
+  return makeRef<MapView>(Ref<Map>(this), View::Values);
 }
 
-Method::result_type Map::items(const std::vector<ObjectPtr>& params) {
+Method::result_type Map::items(Args params) {
   if (params.size() != 0) {
     throw std::runtime_error("items: Invalid number of arguments");
   }
 
-  std::vector<var> itemList;
-  for (const auto& kv : elements) {
-    itemList.push_back(var(Pair(kv.first, kv.second)));
-  }
-  return std::make_shared<List>(itemList);
+  return makeRef<MapView>(Ref<Map>(this), View::Items);
 }
 
-Method::result_type Map::get(const std::vector<ObjectPtr>& params) {
+Method::result_type Map::get(Args params) {
   if (params.size() != 1) {
     throw std::runtime_error("get: Invalid number of arguments");
   }
 
-  var key = params[0];
-  auto it = elements.find(key);
+  auto it = find(params[0]);
 
   if (it != elements.end()) {
-    var match = it->second;
-    return match.getValue();
+    return it->second.getValue();
   }
   
   std::cerr << "get: Key not found\n";
   return nullptr;
 }
 
-ObjectPtr Map::slice(const std::vector<ObjectPtr>& params) {
+Method::result_type Map::has(Args params) {
+  if (params.size() != 1) {
+    throw std::runtime_error("has: Invalid number of arguments");
+  }
+
+  return Boolean::of(find(params[0]) != elements.end());
+}
+
+ObjectPtr Map::slice(Args params) {
   if (params.size() != 1) {
     throw std::runtime_error("Map: Invalid number of arguments");
   }
@@ -208,41 +234,43 @@ ObjectPtr Map::slice(const std::vector<ObjectPtr>& params) {
 }
 
 
-Method::result_type Map::len(const std::vector<ObjectPtr>& params) {
+Method::result_type Map::len(Args params) {
   if (params.size() != 0) {
     throw std::runtime_error("__len__: Invalid number of arguments");
   }
 
-  return std::make_shared<Integer>(elements.size());
+  return Integer::of(elements.size());
 }
 
-Method::result_type Map::min(const std::vector<ObjectPtr>& params) {
+Method::result_type Map::min(Args params) {
   if (params.size() != 0) {
     throw std::runtime_error("__min__: Invalid number of arguments");
   }
 
-  auto lesserSlot = std::min_element(std::begin(elements), std::end(elements));
+  auto lesserSlot = std::min_element(std::begin(elements), std::end(elements),
+    [](const Entry& lhs, const Entry& rhs) { return lhs.first < rhs.first; });
   if (lesserSlot == elements.end()) {
     return nullptr;
   }
 
-  return std::make_shared<Integer>(elements.size());
+  return lesserSlot->first.getValue();
 }
 
-Method::result_type Map::max(const std::vector<ObjectPtr>& params) {
+Method::result_type Map::max(Args params) {
   if (params.size() != 0) {
     throw std::runtime_error("__max__: Invalid number of arguments");
   }
 
-  auto greatestSlot = std::max_element(std::begin(elements), std::end(elements));
+  auto greatestSlot = std::max_element(std::begin(elements), std::end(elements),
+    [](const Entry& lhs, const Entry& rhs) { return lhs.first < rhs.first; });
   if (greatestSlot == elements.end()) {
     return nullptr;
   }
 
-  return std::make_shared<Integer>(elements.size());
+  return greatestSlot->first.getValue();
 }
 
-Method::result_type Map::sum(const std::vector<ObjectPtr>& params) {
+Method::result_type Map::sum(Args params) {
   if (params.size() != 0) {
     throw std::runtime_error("__sum__: Invalid number of arguments");
   }
@@ -256,15 +284,15 @@ Method::result_type Map::sum(const std::vector<ObjectPtr>& params) {
   return result.getValue();
 }
 
-Method::result_type Map::asBoolean(const std::vector<ObjectPtr>& params) {
+Method::result_type Map::asBoolean(Args params) {
   if (params.size() != 0) {
     throw std::runtime_error("__bool__: Invalid number of arguments");
   }
 
-  return std::make_shared<Boolean>(! this->elements.empty());
+  return Boolean::of(! this->elements.empty());
 }
 
-Method::result_type Map::asString(const std::vector<ObjectPtr>& params) {
+Method::result_type Map::asString(Args params) {
   if (params.size() != 0) {
     throw std::runtime_error("__str__: Invalid number of arguments");
   }
@@ -275,20 +303,20 @@ Method::result_type Map::asString(const std::vector<ObjectPtr>& params) {
 
   for (auto it = elements.begin(); it != elements.end(); ++it) {
     if (
-      auto stringPtr = std::dynamic_pointer_cast<String>(
-        it->first->Call("__str__", {})
+      auto stringPtr = objectCast<String>(
+        it->first->Call(Methods::asString, {})
       )
     ) {
-      result.append(stringPtr->getValue());
+      result.append(stringPtr->view());
       result.append(": ");
     }
 
     if (
-      auto stringPtr = std::dynamic_pointer_cast<String>(
-        it->second->Call("__str__", {})
+      auto stringPtr = objectCast<String>(
+        it->second->Call(Methods::asString, {})
       )
     ) {
-      result.append(stringPtr->getValue());
+      result.append(stringPtr->view());
     }
 
     if (std::next(it) != elements.end()) {
@@ -298,17 +326,18 @@ Method::result_type Map::asString(const std::vector<ObjectPtr>& params) {
 
   result.append("}");
 
-  return std::make_shared<String>(result);
+  return makeRef<String>(result);
 }
 
 // ------------------ Iterator ------------------
 using ObjectIt = std::shared_ptr<Object::ObjectIterator>;
 
-Map::MapIterator::MapIterator(const Map& list)
-  : _map(list), _currentIndex(0) {}
+Map::MapIterator::MapIterator(const Map& map, View view, ObjectPtr owner)
+  : _map(map), _view(view), _current(map.elements.begin()), _version(map.version), _owner(std::move(owner)) {}
 
 bool Map::MapIterator::hasNext() const {
-  return _currentIndex < _map.size();
+  _map.checkVersion(_version);
+  return _current != _map.elements.end();
 }
 
 ObjectPtr Map::MapIterator::next() {
@@ -316,16 +345,138 @@ ObjectPtr Map::MapIterator::next() {
     throw std::out_of_range("Iterator out of range");
   }
 
-  auto it = _map.elements.begin();
-  std::advance(it, _currentIndex++);
-
-  return std::make_shared<Pair>(it->first, it->second);
+  return project(*_current++, _view).getValue();
 }
 
 ObjectIt Map::MapIterator::clone() const {
-  return std::make_shared<MapIterator>(*this);
+  return makeIterator<MapIterator>(*this);
 }
 
 ObjectIt Map::getIterator() const {
-  return std::make_shared<MapIterator>(*this);
+  return makeIterator<MapIterator>(*this);
+}
+
+// ------------------ MapView ------------------
+
+MapView::MapView(Ref<Map> map, Map::View view) : Object(tag), map(std::move(map)), view(view) {}
+
+std::vector<var> MapView::elements() const {
+  std::vector<var> result;
+  result.reserve(map->size());
+  for (const auto& kv : map->getValue()) {
+    result.push_back(Map::project(kv, view));
+  }
+  return result;
+}
+
+MapView::operator bool() const {
+  return map->size() != 0;
+}
+
+void MapView::print(std::ostream& os) const {
+  os << "[";
+  const Dict& entries = map->getValue();
+  for (auto it = entries.begin(); it != entries.end(); ++it) {
+    os << Map::project(*it, view);
+    if (std::next(it) != entries.end()) {
+      os << ", ";
+    }
+  }
+  os << "]";
+}
+
+ObjectPtr MapView::clone() const {
+  return makeRef<MapView>(*this);
+}
+
+const MethodTable& MapView::getMethods() const {
+  static const MethodTable methods = MethodTable()
+      .add(Methods::has, &MapView::has)
+      .add(Methods::len, &MapView::len)
+      .add(Methods::min, &MapView::min)
+      .add(Methods::max, &MapView::max)
+      .add(Methods::sum, &MapView::sum)
+      .add(Methods::asString, &MapView::asString)
+      .add(Methods::asBoolean, &MapView::asBoolean);
+  return methods;
+}
+
+Method::result_type MapView::has(Args params) {
+  if (params.size() != 1) {
+    throw std::runtime_error("has: Invalid number of arguments");
+  }
+
+  if (view == Map::View::Keys) {
+    return Boolean::of(map->find(params[0]) != map->getValue().end());
+  }
+
+  const var element = params[0];
+  for (const auto& kv : map->getValue()) {
+    if (Map::project(kv, view) == element) {
+      return Boolean::of(true);
+    }
+  }
+  return Boolean::of(false);
+}
+
+Method::result_type MapView::len(Args params) {
+  if (params.size() != 0) {
+    throw std::runtime_error("__len__: Invalid number of arguments");
+  }
+
+  return Integer::of(map->size());
+}
+
+Method::result_type MapView::min(Args params) {
+  if (params.size() != 0) {
+    throw std::runtime_error("__min__: Invalid number of arguments");
+  }
+
+  std::vector<var> all = elements();
+  auto lesser = std::min_element(all.begin(), all.end());
+  return lesser != all.end() ? lesser->getValue() : nullptr;
+}
+
+Method::result_type MapView::max(Args params) {
+  if (params.size() != 0) {
+    throw std::runtime_error("__max__: Invalid number of arguments");
+  }
+
+  std::vector<var> all = elements();
+  auto greatest = std::max_element(all.begin(), all.end());
+  return greatest != all.end() ? greatest->getValue() : nullptr;
+}
+
+Method::result_type MapView::sum(Args params) {
+  if (params.size() != 0) {
+    throw std::runtime_error("__sum__: Invalid number of arguments");
+  }
+
+  var result = 0;
+  for (const auto& kv : map->getValue()) {
+    result = result + Map::project(kv, view);
+  }
+  return result.getValue();
+}
+
+Method::result_type MapView::asBoolean(Args params) {
+  if (params.size() != 0) {
+    throw std::runtime_error("__bool__: Invalid number of arguments");
+  }
+
+  return Boolean::of(static_cast<bool>(*this));
+}
+
+Method::result_type MapView::asString(Args params) {
+  if (params.size() != 0) {
+    throw std::runtime_error("__str__: Invalid number of arguments");
+  }
+
+  std::ostringstream os;
+  print(os);
+  return makeRef<String>(os.str());
+}
+
+Object::ObjectIt MapView::getIterator() const {
+  return makeIterator<Map::MapIterator>(*map, view, map);
 }
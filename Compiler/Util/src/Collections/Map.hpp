@@ -1,93 +1,168 @@
-// Copyright (c) 2024 Syntax Errors.
-#pragma once
-
-#include <unordered_map>
-#include <memory>
-#include <utility>
-#include <vector>
-#include <list>
-#include "../Object/object.hpp"
-#include "../Object/var.hpp"
-#include "../Primitive/Boolean.hpp"
-#include "./Pair.hpp"
-#include "./List.hpp"
-
-class Map : public Object {
- private:
-  std::unordered_map<var, var> elements;
-  void init();
-
- public:
-  Map();
-  Map(const Map& other);
-  Map(const std::vector<Pair>& pairs);
-
-  // ------------------ Native overrides ------------------
-  // Override the addition method to implement map addition
-  ObjectPtr add(unused const Object& other) const override;
-  // Get value from associated key-value pair
-  ObjectPtr subscript(const Object& other) const override;
-  // Test equality with other maps
-  bool equals(const Object& other) const override;
-  // Print contents
-  void print(std::ostream& os) const override;
-  // Clone itself
-  ObjectPtr clone() const override;
-  // Get underlying map
-  const std::unordered_map<var, var>& getValue();
-
-  // ------------------ Native operators ------------------
-
-  // Access elements in key-value pairs by key
-  var operator[](const var& key) const;
-  // Return merge of itself and another map
-  Map operator+(const Map& other) const;
-
-  // ------------------ Management Methods ------------------
-  // Add key-value entry 
-  Method::result_type addElement(const std::vector<ObjectPtr>& params);
-  // Remove key-value entry by given key
-  Method::result_type pop(const std::vector<ObjectPtr>& params);
-  // Remove all key-value entries
-  Method::result_type clear(const std::vector<ObjectPtr>& params);
-  // Returns the size of the map
-  size_t size() const;
-  // Returns a list of all values in the map
-  Method::result_type keys(const std::vector<ObjectPtr>& params);
-  // Returns a list of all values in the map
-  Method::result_type values(const std::vector<ObjectPtr>& params);
-  // Returns a list of key-value pairs as Pair objects
-  Method::result_type items(const std::vector<ObjectPtr>& params);
-  // Get value associated with key-value pair by key
-  Method::result_type get(const std::vector<ObjectPtr>& params);
-  // Get a value from key
-  Method::result_type slice(const std::vector<ObjectPtr>& params);
-  // Amount of key-value entries in the map
-  Method::result_type len(const std::vector<ObjectPtr>& params);
-  // Smallest key in map
-  Method::result_type min(const std::vector<ObjectPtr>& params);
-  // Greatest key in map
-  Method::result_type max(const std::vector<ObjectPtr>& params);
-  // Sum of all keys in the map
-  Method::result_type sum(const std::vector<ObjectPtr>& params);
-  // True if any items remain in the map
-  Method::result_type asBoolean(const std::vector<ObjectPtr>& params);
-  // String representation of map
-  Method::result_type asString(const std::vector<ObjectPtr>& params);
-
-  // ------------------ Iterator ------------------
-  class MapIterator : public Object::ObjectIterator {
-   private:
-    const Map& _map;
-    size_t _currentIndex;
-
-   public:
-    explicit MapIterator(const Map& list);
-    bool hasNext() const override;
-    ObjectPtr next() override;
-    ObjectIt clone() const override;
-  };
-
-  // Override iteration methods
-  ObjectIt getIterator() const override;
-};
+// Copyright (c) 2024 Syntax Errors.
+#pragma once
+
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <list>
+#include "../Object/object.hpp"
+#include "../Object/var.hpp"
+#include "../Primitive/Boolean.hpp"
+#include "./Dict.hpp"
+#include "./Pair.hpp"
+#include "./List.hpp"
+
+class Map : public Object {
+ private:
+  Dict elements;
+
+  // Bumped whenever keys are inserted or removed, invalidating iteration
+  std::size_t version = 0;
+
+ public:
+  static constexpr TypeTag tag = TypeTag::Map;
+
+  // What iterating over a map yields
+  enum class View : uint8_t { Keys, Values, Items };
+
+  using Entry = Dict::Entry;
+
+  Map();
+  Map(const Map& other);
+  Map(const std::vector<Pair>& pairs);
+  Map(std::initializer_list<Pair> pairs);
+
+  // ------------------ Native overrides ------------------
+  // Override the addition method to implement map addition
+  ObjectPtr add(unused const Object& other) const override;
+  // Get value from associated key-value pair
+  ObjectPtr subscript(const Object& other) const override;
+  var* slot(const Object& other) override;
+  // Test equality with other maps
+  bool equals(const Object& other) const override;
+  // Print contents
+  void print(std::ostream& os) const override;
+  // Clone itself
+  ObjectPtr clone() const override;
+  // Get underlying map
+  const Dict& getValue() const;
+  // Changes whenever keys are inserted or removed
+  inline std::size_t getVersion() const { return version; }
+  // Part of an entry yielded by a view
+  static var project(const Entry& entry, View view);
+  // Fail if the map changed since iteration started at `expectedVersion`
+  void checkVersion(std::size_t expectedVersion) const;
+  // Entry for a borrowed key, or end() (None is never a key)
+  Dict::const_iterator find(const ObjectPtr& key) const;
+
+  // ------------------ Native operators ------------------
+
+  // Access elements in key-value pairs by key
+  var operator[](const var& key) const;
+  // Return merge of itself and another map
+  Map operator+(const Map& other) const;
+
+  // ------------------ Management Methods ------------------
+  // Methods supported by maps
+  const MethodTable& getMethods() const override;
+  // Add key-value entry 
+  Method::result_type addElement(Args params);
+  // Remove key-value entry by given key
+  Method::result_type pop(Args params);
+  // Remove all key-value entries
+  Method::result_type clear(Args params);
+  // Returns the size of the map
+  size_t size() const;
+  // Returns a view of all keys in the map
+  Method::result_type keys(Args params);
+  // Returns a view of all values in the map
+  Method::result_type values(Args params);
+  // Returns a view of key-value pairs as Pair objects
+  Method::result_type items(Args params);
+  // Get value associated with key-value pair by key
+  Method::result_type get(Args params);
+  // Lookup a key in map
+  Method::result_type has(Args params);
+  // Get a value from key
+  Method::result_type slice(Args params);
+  // Amount of key-value entries in the map
+  Method::result_type len(Args params);
+  // Smallest key in map
+  Method::result_type min(Args params);
+  // Greatest key in map
+  Method::result_type max(Args params);
+  // Sum of all keys in the map
+  Method::result_type sum(Args params);
+  // True if any items remain in the map
+  Method::result_type asBoolean(Args params);
+  // String representation of map
+  Method::result_type asString(Args params);
+
+  // ------------------ Iterator ------------------
+  class MapIterator : public Object::ObjectIterator {
+   private:
+    const Map& _map;
+    View _view;
+    Dict::const_iterator _current;
+    std::size_t _version;
+
+    // Holder of the map, kept alive along with the iterator when given
+    ObjectPtr _owner;
+
+   public:
+    explicit MapIterator(const Map& map, View view = View::Items, ObjectPtr owner = nullptr);
+    bool hasNext() const override;
+    ObjectPtr next() override;
+    ObjectIt clone() const override;
+  };
+
+  // Override iteration methods
+  ObjectIt getIterator() const override;
+};
+
+// Keys, values or items of a map, as returned by keys(), values() and items().
+// Walks the entries of the map it was taken from instead of copying them. The
+// map is shared like any other copy, so changing it through its variable
+// leaves the view on the entries it had
+class MapView : public Object {
+ private:
+  Ref<Map> map;
+  Map::View view;
+
+ public:
+  static constexpr TypeTag tag = TypeTag::MapView;
+
+  MapView(Ref<Map> map, Map::View view);
+
+  inline const Map& getMap() const { return *map; }
+  inline Map::View getView() const { return view; }
+
+  // Elements of the view, in the map's order
+  std::vector<var> elements() const;
+
+  // ------------------ Native overrides ------------------
+  explicit operator bool() const override;
+  void print(std::ostream& os) const override;
+  ObjectPtr clone() const override;
+
+  // ------------------ Management Methods ------------------
+  const MethodTable& getMethods() const override;
+  // Lookup an element, by hash for keys
+  Method::result_type has(Args params);
+  // Amount of entries in the map
+  Method::result_type len(Args params);
+  // Smallest element
+  Method::result_type min(Args params);
+  // Greatest element
+  Method::result_type max(Args params);
+  // Sum of all elements
+  Method::result_type sum(Args params);
+  // True if the map has any entries
+  Method::result_type asBoolean(Args params);
+  // String representation, as a list
+  Method::result_type asString(Args params);
+
+  // ------------------ Iterator ------------------
+  ObjectIt getIterator() const override;
+};
@@ -8,29 +8,29 @@
 #include "../Numeric/Integer.hpp"
 
 
-Pair::Pair() { init(); }
+Pair::Pair() : Object(tag) {}
 
 Pair::operator ObjectPtr() {
-  init();
-  return std::make_shared<Pair>(*this);
+  return makeRef<Pair>(*this);
 }
 
 // Parameterized constructor
 Pair::Pair(var first, var second)
-  : value(std::make_pair(first, second)) { init(); }
+  : Object(tag), value(std::make_pair(first, second)) {}
 
 // Copy constructor
 Pair::Pair(const Pair& other)
-  : value(other.value) { init(); }
+  : Object(other), value(other.value), _hash(other._hash) {}
 
 // Move constructor
 Pair::Pair(Pair&& other) noexcept
-  : value(std::move(other.value)) { init(); }
+  : Object(other), value(std::move(other.value)), _hash(other._hash) {}
 
 // ------------------ Native operators ------------------
 Pair& Pair::operator=(const Pair& other) {
   if (this != &other) {
     value = other.value;
+    _hash = other._hash;
   }
   return *this;
 }
@@ -38,6 +38,7 @@ Pair& Pair::operator=(const Pair& other) {
 Pair& Pair::operator=(Pair&& other) noexcept {
   if (this != &other) {
     value = std::move(other.value);
+    _hash = other._hash;
   }
   return *this;
 }
@@ -67,25 +68,29 @@ bool Pair::operator>=(const Pair& other) const {
 }
 
 bool Pair::equals(const Object& other) const {
-  auto otherObj = dynamic_cast<const Pair*>(&other);
+  auto otherObj = objectCast<Pair>(&other);
   if (otherObj) {
     return value == otherObj->value;
   }
   throw std::runtime_error("Pair does not support comparison with given type");
 }
 
-bool Pair::less(const Object& other) const {
-  auto otherObj = dynamic_cast<const Pair*>(&other);
-  if (otherObj) {
-    return value < otherObj->value;
-  }
-  throw std::runtime_error("Pair does not support comparison with given type");
+// Combined like the elements of a collection
+std::size_t Pair::hash() const {
+  return _hash.get([this] {
+    std::size_t seed = 2;
+    seed ^= value.first.hash() + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= value.second.hash() + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+  });
 }
 
-bool Pair::greater(const Object& other) const {
-  auto otherObj = dynamic_cast<const Pair*>(&other);
+// Key first, then value
+std::partial_ordering Pair::compare(const Object& other) const {
+  auto otherObj = objectCast<Pair>(&other);
   if (otherObj) {
-    return value > otherObj->value;
+    std::partial_ordering order = value.first.compare(otherObj->value.first);
+    return order != 0 ? order : value.second.compare(otherObj->value.second);
   }
   throw std::runtime_error("Pair does not support comparison with given type");
 }
@@ -97,6 +102,7 @@ var Pair::getFirst() const {
 
 void Pair::setFirst(const var& first) {
   value.first = first;
+  _hash.reset();
 }
 
 var Pair::getSecond() const {
@@ -105,10 +111,12 @@ var Pair::getSecond() const {
 
 void Pair::setSecond(const var& second) {
   value.second = second;
+  _hash.reset();
 }
 
 void Pair::swap(Pair& other) noexcept {
   std::swap(value, other.value);
+  std::swap(_hash, other._hash);
 }
 
 // Print function
@@ -121,26 +129,28 @@ void Pair::print(std::ostream& os) const {
 }
 
 ObjectPtr Pair::clone() const {
-  return std::make_shared<Pair>(*this);
+  return makeRef<Pair>(*this);
 };
 
-void Pair::init() {
-  _methods["__len__"] = std::bind(&Pair::len, this, std::placeholders::_1);
-  _methods["__bool__"] = std::bind(&Pair::asBoolean, this, std::placeholders::_1);
-  _methods["__str__"] = std::bind(&Pair::asString, this, std::placeholders::_1);
+const MethodTable& Pair::getMethods() const {
+  static const MethodTable methods = MethodTable()
+      .add(Methods::len, &Pair::len)
+      .add(Methods::asBoolean, &Pair::asBoolean)
+      .add(Methods::asString, &Pair::asString);
+  return methods;
 }
 
 // Return two
-Object::Method::result_type Pair::len(const std::vector<ObjectPtr>& params) {
+Object::Method::result_type Pair::len(Args params) {
   if (params.size() != 0) {
     throw std::runtime_error("__str__: Invalid number of arguments");
   }
 
-  return std::make_shared<Integer>(2);
+  return Integer::of(2);
 }
 
 // Get string representation of pair
-Object::Method::result_type Pair::asString(const std::vector<ObjectPtr>& params) {
+Object::Method::result_type Pair::asString(Args params) {
   if (params.size() != 0) {
     throw std::runtime_error("__str__: Invalid number of arguments");
   }
@@ -150,35 +160,35 @@ Object::Method::result_type Pair::asString(const std::vector<ObjectPtr>& params)
   result.append("(");
 
   if (
-    auto stringPtr = std::dynamic_pointer_cast<String>(
-      this->value.first.Call("__str__", {})
+    auto stringPtr = objectCast<String>(
+      this->value.first.Call(Methods::asString, {})
     )
   ) {
-    result.append(stringPtr->getValue());
+    result.append(stringPtr->view());
   }
 
   result.append(", ");
 
   if (
-    auto stringPtr = std::dynamic_pointer_cast<String>(
-      this->value.second.Call("__str__", {})
+    auto stringPtr = objectCast<String>(
+      this->value.second.Call(Methods::asString, {})
     )
   ) {
-    result.append(stringPtr->getValue());
+    result.append(stringPtr->view());
   }
 
   result.append(")");
 
-  return std::make_shared<String>(result);
+  return makeRef<String>(result);
 }
 
 // Return true
-Object::Method::result_type Pair::asBoolean(const std::vector<ObjectPtr>& params) {
+Object::Method::result_type Pair::asBoolean(Args params) {
   if (params.size() != 0) {
     throw std::runtime_error("__bool__: Invalid number of arguments");
   }
 
-  return std::make_shared<Boolean>(true);
+  return Boolean::of(true);
 }
 
 // Non-member swap for ADL
@@ -11,9 +11,13 @@
 class Pair : public Object {
  private:
   std::pair<var, var> value;
-  void init();
+
+  // Kept until one of the sides is replaced
+  HashCache _hash;
 
  public:
+  static constexpr TypeTag tag = TypeTag::Pair;
+
   // Default constructor
   Pair();
 
@@ -42,14 +46,14 @@ class Pair : public Object {
 
   bool equals(const Object& other) const;
 
+  std::size_t hash() const override;
+
   bool operator!=(const Pair& other) const;
 
   // Comparison operators
   bool operator<(const Pair& other) const;
 
-  bool less(const Object& other) const override;
-
-  bool greater(const Object& other) const override;
+  std::partial_ordering compare(const Object& other) const override;
 
   bool operator<=(const Pair& other) const;
 
@@ -75,9 +79,10 @@ class Pair : public Object {
   void print(std::ostream& os) const override;
 
   // Management methods
-  Object::Method::result_type len(const std::vector<ObjectPtr>& params);
-  Object::Method::result_type asString(const std::vector<ObjectPtr>& params);
-  Object::Method::result_type asBoolean(const std::vector<ObjectPtr>& params);
+  const MethodTable& getMethods() const override;
+  Object::Method::result_type len(Args params);
+  Object::Method::result_type asString(Args params);
+  Object::Method::result_type asBoolean(Args params);
 };
 
 // Non-member swap for ADL
@@ -0,0 +1,687 @@
+// Copyright (c) 2024 Syntax Errors.
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+#include "./Sequence.hpp"
+#include "./FlatSet.hpp"
+#include "./SortKernels.hpp"
+#include "../Numeric/NumericKernels.hpp"
+#include "../Object/tasks.hpp"
+#include "../Primitive/String.hpp"
+
+// Linear lookups a long sequence answers before it builds its hash index.
+// Override with -DSEQUENCE_INDEX_LOOKUPS=<count>
+#ifndef SEQUENCE_INDEX_LOOKUPS
+#define SEQUENCE_INDEX_LOOKUPS 8
+#endif
+
+namespace {
+  // Shorter sequences are scanned faster than they are hashed
+  constexpr std::size_t minimumIndexedSize = 32;
+
+  // Shorter slices are copied, which costs less than sharing storage
+  constexpr std::size_t minimumSharedSize = 16;
+
+  // Elements per chunk of the reductions and searches below. Fixed, so the
+  // grouping of a floating-point sum never depends on the number of threads
+  constexpr std::size_t chunkSize = 1 << 16;
+
+  // Reduce a buffer a chunk at a time (on the thread pool for large ones),
+  // then combine the chunk results pairwise along a fixed tree
+  template <typename T, typename Kernel, typename Combine>
+  T reduceChunks(const T* data, std::size_t size, Kernel kernel, Combine combine) {
+    const std::size_t chunks = (size + chunkSize - 1) / chunkSize;
+    if (chunks <= 1) {
+      return kernel(data, size);
+    }
+
+    std::vector<T> partial(chunks);
+    auto reduceChunk = [&](std::size_t chunk) {
+      const std::size_t start = chunk * chunkSize;
+      partial[chunk] = kernel(data + start, std::min(chunkSize, size - start));
+    };
+    if (Tasks::worthSplitting(size)) {
+      Tasks::parallelFor(chunks, reduceChunk);
+    } else {
+      for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+        reduceChunk(chunk);
+      }
+    }
+
+    for (std::size_t width = 1; width < chunks; width *= 2) {
+      for (std::size_t chunk = 0; chunk + width < chunks; chunk += 2 * width) {
+        partial[chunk] = combine(partial[chunk], partial[chunk + width]);
+      }
+    }
+    return partial[0];
+  }
+
+  // First position of `value`, searching chunks on the thread pool for large
+  // buffers. Chunks past a match already found are skipped
+  template <typename T>
+  std::size_t findChunks(const T* data, std::size_t size, T value) {
+    if (!Tasks::worthSplitting(size)) {
+      return NumericKernels::find(data, size, value);
+    }
+
+    std::atomic<std::size_t> first{NumericKernels::npos};
+    Tasks::parallelFor((size + chunkSize - 1) / chunkSize, [&](std::size_t chunk) {
+      const std::size_t start = chunk * chunkSize;
+      if (start >= first.load(std::memory_order_relaxed)) {
+        return;
+      }
+
+      const std::size_t match = NumericKernels::find(data + start, std::min(chunkSize, size - start), value);
+      if (match != NumericKernels::npos) {
+        std::size_t seen = first.load(std::memory_order_relaxed);
+        while (start + match < seen && !first.compare_exchange_weak(seen, start + match)) {
+        }
+      }
+    });
+    return first.load();
+  }
+
+  inline int32_t wrappingAdd(int32_t lhs, int32_t rhs) {
+    return static_cast<int32_t>(static_cast<uint32_t>(lhs) + static_cast<uint32_t>(rhs));
+  }
+
+  inline bool isString(const var& element) {
+    return element.getKind() == var::Kind::Object && static_cast<const Object&>(element).type() == TypeTag::String;
+  }
+
+  // Elements whose hash and equality never change: numbers, booleans and strings
+  inline bool indexable(const var& element) {
+    switch (element.getKind()) {
+      case var::Kind::Integer:
+      case var::Kind::Double:
+      case var::Kind::Boolean:
+        return true;
+      case var::Kind::Object:
+        return isString(element);
+      default:
+        return false;
+    }
+  }
+
+  // Whole Doubles equal the Integer of the same value, so they hash like it
+  inline std::size_t indexHash(const var& element) {
+    if (element.getKind() == var::Kind::Double) {
+      double real = element.realValue();
+      if (real >= std::numeric_limits<int32_t>::min() && real <= std::numeric_limits<int32_t>::max()
+          && std::trunc(real) == real) {
+        return std::hash<int32_t>{}(static_cast<int32_t>(real));
+      }
+    }
+    return element.hash();
+  }
+
+  // An element and the first position holding it
+  struct IndexEntry {
+    var element;
+    std::size_t position = 0;
+  };
+
+  struct IndexHash {
+    using is_transparent = void;
+
+    inline std::size_t operator()(const IndexEntry& entry) const { return indexHash(entry.element); }
+    inline std::size_t operator()(const var& element) const { return indexHash(element); }
+  };
+
+  struct IndexEqual {
+    using is_transparent = void;
+
+    inline bool operator()(const IndexEntry& lhs, const IndexEntry& rhs) const { return lhs.element == rhs.element; }
+    inline bool operator()(const IndexEntry& lhs, const var& rhs) const { return lhs.element == rhs; }
+  };
+
+  // A sort key and the position of the element it was taken from
+  template <typename K>
+  struct Decorated {
+    K key;
+    std::size_t position;
+  };
+
+  // Positions of `keys` in stable ascending order. Numbers and strings are
+  // compared directly, anything else through var, and only positions move
+  // so a failed comparison leaves the elements as they were
+  std::vector<std::size_t> sortedOrder(const Sequence& keys) {
+    const std::size_t count = keys.size();
+    std::vector<std::size_t> order(count);
+
+    auto decorate = [&order, count](auto keyAt) {
+      using K = decltype(keyAt(std::size_t()));
+      std::vector<Decorated<K>> decorated;
+      decorated.reserve(count);
+      for (std::size_t position = 0; position < count; ++position) {
+        decorated.push_back(Decorated<K>{keyAt(position), position});
+      }
+
+      SortKernels::timsort(decorated.data(), count,
+          [](const Decorated<K>& lhs, const Decorated<K>& rhs) { return lhs.key < rhs.key; });
+      for (std::size_t index = 0; index < count; ++index) {
+        order[index] = decorated[index].position;
+      }
+    };
+
+    switch (keys.layout()) {
+      case Sequence::Layout::Integer:
+        decorate([&keys](std::size_t position) { return keys.integers()[position]; });
+        break;
+      case Sequence::Layout::Double:
+        decorate([&keys](std::size_t position) { return keys.reals()[position]; });
+        break;
+      default: {
+        std::span<const var> items = keys.items();
+        if (std::all_of(items.begin(), items.end(), isString)) {
+          // Byte order of UTF-8 is code point order, as Python compares strings
+          decorate([&items](std::size_t position) {
+            return static_cast<const String&>(static_cast<const Object&>(items[position])).view();
+          });
+        } else {
+          std::iota(order.begin(), order.end(), 0);
+          SortKernels::timsort(order.data(), count,
+              [&items](std::size_t lhs, std::size_t rhs) { return items[lhs] < items[rhs]; });
+        }
+        break;
+      }
+    }
+    return order;
+  }
+}
+
+struct Sequence::Index {
+  // Lookups counted towards building the entries
+  std::size_t lookups = 0;
+  bool built = false;
+  FlatSet<IndexEntry, IndexHash, IndexEqual> entries;
+};
+
+Sequence::Sequence() = default;
+
+Sequence::Sequence(const Sequence& other)
+    : _items(other._items), _shared(other._shared), _start(other._start), _count(other._count) {}
+
+Sequence::Sequence(Sequence&& other) noexcept = default;
+
+Sequence& Sequence::operator=(const Sequence& other) {
+  if (this != &other) {
+    _items = other._items;
+    _shared = other._shared;
+    _start = other._start;
+    _count = other._count;
+    _index.reset();
+  }
+  return *this;
+}
+
+Sequence& Sequence::operator=(Sequence&& other) noexcept = default;
+
+Sequence::~Sequence() = default;
+
+Sequence::Sequence(const std::vector<var>& elements) {
+  Layout common = elements.empty() ? Layout::Integer : layoutOf(elements.front());
+  for (const var& element : elements) {
+    if (layoutOf(element) != common) {
+      common = Layout::Boxed;
+      break;
+    }
+  }
+
+  switch (common) {
+    case Layout::Integer: {
+      std::vector<int32_t>& buffer = integers();
+      buffer.reserve(elements.size());
+      for (const var& element : elements) {
+        buffer.push_back(element.integerValue());
+      }
+      break;
+    }
+    case Layout::Double: {
+      std::vector<double>& buffer = _items.emplace<1>();
+      buffer.reserve(elements.size());
+      for (const var& element : elements) {
+        buffer.push_back(element.realValue());
+      }
+      break;
+    }
+    default:
+      _items.emplace<2>(elements);
+      break;
+  }
+}
+
+// ------------------ Storage ------------------
+
+Sequence::Items Sequence::copied(const Items& items, std::size_t start, std::size_t count) {
+  return std::visit([start, count](const auto& buffer) -> Items {
+    return std::remove_cvref_t<decltype(buffer)>(buffer.begin() + start, buffer.begin() + start + count);
+  }, items);
+}
+
+void Sequence::own() {
+  if (!_shared) {
+    return;
+  }
+
+  // Storage nothing else sees is taken back whole, else the window is copied
+  const bool whole = std::visit([this](const auto& items) { return _start == 0 && _count == items.size(); }, *_shared);
+  if (whole && _shared.use_count() == 1) {
+    _items = std::move(*_shared);
+  } else {
+    _items = copied(*_shared, _start, _count);
+  }
+  _shared.reset();
+}
+
+void Sequence::share() const {
+  if (!_shared) {
+    _count = size();
+    _start = 0;
+    _shared = std::make_shared<Items>(std::move(_items));
+    _items = Items();
+  }
+}
+
+Sequence Sequence::slice(std::size_t start, std::size_t end) const {
+  Sequence result;
+  if (end <= start) {
+    return result;
+  }
+
+  const std::size_t count = end - start;
+  if (count < minimumSharedSize) {
+    result._items = copied(storage(), (_shared ? _start : 0) + start, count);
+    return result;
+  }
+
+  share();
+  result._shared = _shared;
+  result._start = _start + start;
+  result._count = count;
+  return result;
+}
+
+// ------------------ Layout ------------------
+
+Sequence::Layout Sequence::layoutOf(const var& element) {
+  switch (element.getKind()) {
+    case var::Kind::Integer: return Layout::Integer;
+    case var::Kind::Double: return Layout::Double;
+    default: return Layout::Boxed;
+  }
+}
+
+void Sequence::box() {
+  switch (layout()) {
+    case Layout::Integer: {
+      std::vector<var> items(integers().begin(), integers().end());
+      _items = std::move(items);
+      break;
+    }
+    case Layout::Double: {
+      std::vector<var> items(reals().begin(), reals().end());
+      _items = std::move(items);
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+void Sequence::accept(const var& element) {
+  const Layout needed = layoutOf(element);
+  if (needed == layout()) {
+    return;
+  }
+
+  // An empty sequence starts over in whichever layout fits
+  if (empty()) {
+    switch (needed) {
+      case Layout::Integer: _items.emplace<0>(); break;
+      case Layout::Double: _items.emplace<1>(); break;
+      default: _items.emplace<2>(); break;
+    }
+    return;
+  }
+
+  box();
+}
+
+// ------------------ Index ------------------
+
+void Sequence::buildIndex() const {
+  const std::size_t count = size();
+  if (isBoxed() && !std::all_of(items().begin(), items().end(), indexable)) {
+    // Try again after as many lookups, the elements may have changed by then
+    _index->lookups = 0;
+    return;
+  }
+
+  _index->built = true;
+  for (std::size_t position = 0; position < count; ++position) {
+    // Keeps the first position of repeated elements
+    _index->entries.insert(IndexEntry{(*this)[position], position});
+  }
+}
+
+void Sequence::indexFrom(std::size_t start) {
+  if (!_index || !_index->built) {
+    return;
+  }
+
+  const std::size_t count = size();
+  for (std::size_t position = start; position < count; ++position) {
+    var element = (*this)[position];
+    if (!indexable(element)) {
+      _index.reset();
+      return;
+    }
+    _index->entries.insert(IndexEntry{std::move(element), position});
+  }
+}
+
+// ------------------ Modifiers ------------------
+
+void Sequence::reserve(std::size_t count) {
+  own();
+  std::visit([count](auto& items) { items.reserve(count); }, _items);
+}
+
+void Sequence::clear() {
+  _shared.reset();
+  _items.emplace<0>();
+  _index.reset();
+}
+
+void Sequence::push_back(const var& element) {
+  own();
+  accept(element);
+  switch (layout()) {
+    case Layout::Integer: integers().push_back(element.integerValue()); break;
+    case Layout::Double: reals().push_back(element.realValue()); break;
+    default: boxed().push_back(element); break;
+  }
+  indexFrom(size() - 1);
+}
+
+void Sequence::append(const Sequence& other) {
+  const std::size_t count = other.size();
+  if (count == 0) {
+    return;
+  }
+  if (empty()) {
+    *this = other;
+    return;
+  }
+
+  own();
+  if (layout() != other.layout()) {
+    box();
+  }
+
+  // Copied by position after growing, so appending a sequence to itself
+  // reads elements that stay put
+  const std::size_t start = size();
+  switch (layout()) {
+    case Layout::Integer:
+      integers().resize(start + count);
+      std::copy_n(other.integers().data(), count, integers().data() + start);
+      break;
+    case Layout::Double:
+      reals().resize(start + count);
+      std::copy_n(other.reals().data(), count, reals().data() + start);
+      break;
+    default:
+      boxed().reserve(start + count);
+      for (std::size_t index = 0; index < count; ++index) {
+        boxed().push_back(other[index]);
+      }
+      break;
+  }
+  indexFrom(start);
+}
+
+Sequence::const_iterator Sequence::insert(const_iterator position, const var& element) {
+  own();
+  const std::size_t index = position.index;
+  if (index != size()) {
+    // Every later position shifts
+    _index.reset();
+  }
+  accept(element);
+  switch (layout()) {
+    case Layout::Integer: integers().insert(integers().begin() + index, element.integerValue()); break;
+    case Layout::Double: reals().insert(reals().begin() + index, element.realValue()); break;
+    default: boxed().insert(boxed().begin() + index, element); break;
+  }
+  indexFrom(index);
+  return const_iterator(this, index);
+}
+
+Sequence::const_iterator Sequence::erase(const_iterator position) {
+  own();
+  const std::size_t index = position.index;
+  if (_index && _index->built && index + 1 == size()) {
+    // Only the last element's own entry goes, an earlier copy keeps its position
+    auto entry = _index->entries.find((*this)[index]);
+    if (entry != _index->entries.end() && entry->position == index) {
+      _index->entries.erase(entry);
+    }
+  } else {
+    _index.reset();
+  }
+  std::visit([index](auto& items) { items.erase(items.begin() + index); }, _items);
+  return const_iterator(this, index);
+}
+
+void Sequence::sort(const Key& key) {
+  own();
+  const std::size_t count = size();
+  std::vector<std::size_t> order;
+  if (key) {
+    // Decorated once, so the key runs once per element
+    Sequence keys;
+    keys.reserve(count);
+    for (std::size_t position = 0; position < count; ++position) {
+      keys.push_back(key((*this)[position]));
+    }
+    if (size() != count) {
+      throw std::runtime_error("sort: List modified during sort");
+    }
+    order = sortedOrder(keys);
+  } else {
+    switch (layout()) {
+      case Layout::Integer:
+        SortKernels::sort(integers().data(), count);
+        _index.reset();
+        return;
+      case Layout::Double:
+        SortKernels::sort(reals().data(), count);
+        _index.reset();
+        return;
+      default:
+        order = sortedOrder(*this);
+        break;
+    }
+  }
+
+  std::visit([&order](auto& items) {
+    std::remove_reference_t<decltype(items)> sorted;
+    sorted.reserve(items.size());
+    for (std::size_t position : order) {
+      sorted.push_back(std::move(items[position]));
+    }
+    items.swap(sorted);
+  }, _items);
+  _index.reset();
+}
+
+var* Sequence::slot(std::size_t index) {
+  if (!isBoxed()) {
+    return nullptr;
+  }
+  own();
+  return &boxed()[index];
+}
+
+// ------------------ Queries ------------------
+
+std::size_t Sequence::find(const var& query, std::size_t from) const {
+  const std::size_t count = size();
+  if (from >= count) {
+    return npos;
+  }
+
+  // Whole-sequence lookups on a long sequence count towards, then use, the index
+  if (from == 0 && count >= minimumIndexedSize) {
+    if (!_index) {
+      _index = std::make_unique<Index>();
+    }
+    if (!_index->built && ++_index->lookups >= SEQUENCE_INDEX_LOOKUPS) {
+      buildIndex();
+    }
+    if (_index->built) {
+      // Indexed elements are never equal to anything else
+      if (!indexable(query)) {
+        return npos;
+      }
+      auto entry = _index->entries.find(query);
+      return entry == _index->entries.end() ? npos : entry->position;
+    }
+  }
+
+  // Numbers only ever equal numbers
+  const bool isNumber = query.getKind() == var::Kind::Integer || query.getKind() == var::Kind::Double;
+  auto found = [from](std::size_t match) { return match == NumericKernels::npos ? npos : from + match; };
+
+  switch (layout()) {
+    case Layout::Integer: {
+      if (!isNumber) {
+        return npos;
+      }
+
+      int32_t needle = query.integerValue();
+      if (query.getKind() == var::Kind::Double) {
+        // Only a whole number within range equals an Integer
+        double real = query.realValue();
+        if (!(real >= std::numeric_limits<int32_t>::min() && real <= std::numeric_limits<int32_t>::max())
+            || std::trunc(real) != real) {
+          return npos;
+        }
+        needle = static_cast<int32_t>(real);
+      }
+      return found(findChunks(integers().data() + from, count - from, needle));
+    }
+    case Layout::Double: {
+      if (!isNumber) {
+        return npos;
+      }
+
+      double needle = query.getKind() == var::Kind::Integer ? query.integerValue() : query.realValue();
+      return found(findChunks(reals().data() + from, count - from, needle));
+    }
+    default: {
+      std::span<const var> elements = items();
+      for (std::size_t index = from; index < count; ++index) {
+        if (elements[index] == query) {
+          return index;
+        }
+      }
+      return npos;
+    }
+  }
+}
+
+var Sequence::sum() const {
+  if (layout() == Layout::Double) {
+    return var(reduceChunks(reals().data(), reals().size(),
+        [](const double* data, std::size_t size) { return NumericKernels::sum(data, size); }, std::plus<double>()));
+  }
+  return var(reduceChunks(integers().data(), integers().size(),
+      [](const int32_t* data, std::size_t size) { return NumericKernels::sum(data, size); }, wrappingAdd));
+}
+
+var Sequence::min() const {
+  if (layout() == Layout::Double) {
+    return var(reduceChunks(reals().data(), reals().size(),
+        [](const double* data, std::size_t size) { return NumericKernels::min(data, size); },
+        [](double lhs, double rhs) { return std::min(lhs, rhs); }));
+  }
+  return var(reduceChunks(integers().data(), integers().size(),
+      [](const int32_t* data, std::size_t size) { return NumericKernels::min(data, size); },
+      [](int32_t lhs, int32_t rhs) { return std::min(lhs, rhs); }));
+}
+
+var Sequence::max() const {
+  if (layout() == Layout::Double) {
+    return var(reduceChunks(reals().data(), reals().size(),
+        [](const double* data, std::size_t size) { return NumericKernels::max(data, size); },
+        [](double lhs, double rhs) { return std::max(lhs, rhs); }));
+  }
+  return var(reduceChunks(integers().data(), integers().size(),
+      [](const int32_t* data, std::size_t size) { return NumericKernels::max(data, size); },
+      [](int32_t lhs, int32_t rhs) { return std::max(lhs, rhs); }));
+}
+
+// ------------------ Comparisons ------------------
+
+bool Sequence::operator==(const Sequence& other) const {
+  const std::size_t count = size();
+  if (count != other.size()) {
+    return false;
+  }
+
+  if (layout() == other.layout()) {
+    switch (layout()) {
+      case Layout::Integer: return NumericKernels::equal(integers().data(), other.integers().data(), count);
+      case Layout::Double: return NumericKernels::equal(reals().data(), other.reals().data(), count);
+      default: return std::equal(items().begin(), items().end(), other.items().begin());
+    }
+  }
+
+  for (std::size_t index = 0; index < count; ++index) {
+    if ((*this)[index] != other[index]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::partial_ordering Sequence::compare(const Sequence& other) const {
+  if (layout() == other.layout()) {
+    switch (layout()) {
+      case Layout::Integer:
+        return std::lexicographical_compare_three_way(integers().begin(), integers().end(),
+            other.integers().begin(), other.integers().end());
+      case Layout::Double:
+        return std::lexicographical_compare_three_way(reals().begin(), reals().end(),
+            other.reals().begin(), other.reals().end());
+      default: {
+        std::span<const var> elements = items();
+        std::span<const var> otherElements = other.items();
+        const std::size_t count = std::min(elements.size(), otherElements.size());
+        for (std::size_t index = 0; index < count; ++index) {
+          std::partial_ordering order = elements[index].compare(otherElements[index]);
+          if (order != 0) {
+            return order;
+          }
+        }
+        return elements.size() <=> otherElements.size();
+      }
+    }
+  }
+
+  const std::size_t count = std::min(size(), other.size());
+  for (std::size_t index = 0; index < count; ++index) {
+    std::partial_ordering order = (*this)[index].compare(other[index]);
+    if (order != 0) {
+      return order;
+    }
+  }
+  return size() <=> other.size();
+}
@@ -0,0 +1,245 @@
+// Copyright (c) 2024 Syntax Errors.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <variant>
+#include <vector>
+
+#include "../Object/var.hpp"
+
+// Elements of a List or Tuple, in the shape Collection expects. While every
+// element is an Integer, or every one a Double, they are kept unboxed in a
+// contiguous buffer that sums, searches and comparisons scan with the
+// NumericKernels. The first element of any other type moves the whole
+// sequence to boxed vars, which it keeps until emptied.
+// A long sequence searched again and again builds a hash index from element to
+// first position, which appends keep up to date and other changes drop.
+// Slicing moves the buffer to storage shared by the sequence and its slices,
+// each seeing a window of it, until one of them changes and copies its
+// window out. Moving keeps the buffer where it was, so slicing leaves the
+// elements alone and is a const operation
+class Sequence {
+ public:
+  enum class Layout : uint8_t { Integer, Double, Boxed };
+
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+  // Sort key taken from each element, like the key= of Python's sorted()
+  using Key = std::function<var(const var&)>;
+
+ private:
+  // Alternatives in Layout order
+  using Items = std::variant<std::vector<int32_t>, std::vector<double>, std::vector<var>>;
+
+  // Elements, unless they are in shared storage. Slicing a const sequence
+  // moves them there (see share())
+  mutable Items _items;
+
+  // Storage shared with slices, of which this sequence holds the `_count`
+  // elements from `_start` on
+  mutable std::shared_ptr<Items> _shared;
+  mutable std::size_t _start = 0;
+  mutable std::size_t _count = 0;
+
+  inline const Items& storage() const { return _shared ? *_shared : _items; }
+
+  // Elements `start` to `start + count` of `items`, in the same layout
+  static Items copied(const Items& items, std::size_t start, std::size_t count);
+
+  // Hold the elements in `_items` again, before any change
+  void own();
+
+  // Move the elements to shared storage, if not there yet. The buffer moves
+  // along with its elements, so pointers and spans to them stay valid and
+  // the sequence is unchanged to anyone holding it
+  void share() const;
+
+  // Buffers of an owned sequence
+  inline std::vector<int32_t>& integers() { return std::get<0>(_items); }
+  inline std::vector<double>& reals() { return std::get<1>(_items); }
+  inline std::vector<var>& boxed() { return std::get<2>(_items); }
+
+  // The elements of this sequence within a buffer of the storage
+  template <std::size_t Alternative>
+  inline auto window() const {
+    const auto& buffer = std::get<Alternative>(storage());
+    return std::span(buffer.data() + (_shared ? _start : 0), size());
+  }
+
+  // Layout an empty sequence takes for its first element
+  static Layout layoutOf(const var& element);
+
+  // Move every element to boxed storage
+  void box();
+
+  // Make room for `element` in the current layout, boxing if it does not fit
+  void accept(const var& element);
+
+  // Lookup counter and, once built, hash index (see Sequence.cpp)
+  struct Index;
+  mutable std::unique_ptr<Index> _index;
+
+  // Build the index if every element can be hashed for good
+  void buildIndex() const;
+
+  // Add elements appended from `start` on to a built index
+  void indexFrom(std::size_t start);
+
+ public:
+  // Positions visited in order. Elements are produced by value, unboxed
+  // numbers have no var to refer to
+  class const_iterator {
+    friend class Sequence;
+
+   private:
+    const Sequence* sequence = nullptr;
+    std::size_t index = 0;
+
+   public:
+    // Holds the element for operator->
+    struct Arrow {
+      var element;
+      inline const var* operator->() const { return &element; }
+    };
+
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = var;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Arrow;
+    using reference = var;
+
+    const_iterator() = default;
+
+    const_iterator(const Sequence* sequence, std::size_t index) : sequence(sequence), index(index) {}
+
+    inline reference operator*() const { return (*sequence)[index]; }
+
+    inline pointer operator->() const { return Arrow{(*sequence)[index]}; }
+
+    inline reference operator[](difference_type offset) const { return (*sequence)[index + offset]; }
+
+    inline const_iterator& operator++() { ++index; return *this; }
+    inline const_iterator operator++(int) { const_iterator previous = *this; ++index; return previous; }
+    inline const_iterator& operator--() { --index; return *this; }
+    inline const_iterator operator--(int) { const_iterator previous = *this; --index; return previous; }
+
+    inline const_iterator& operator+=(difference_type offset) { index += offset; return *this; }
+    inline const_iterator& operator-=(difference_type offset) { index -= offset; return *this; }
+    inline const_iterator operator+(difference_type offset) const { return const_iterator(sequence, index + offset); }
+    inline const_iterator operator-(difference_type offset) const { return const_iterator(sequence, index - offset); }
+    inline difference_type operator-(const const_iterator& other) const {
+      return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+    }
+
+    inline bool operator==(const const_iterator& other) const { return index == other.index; }
+    inline auto operator<=>(const const_iterator& other) const { return index <=> other.index; }
+
+    inline std::size_t position() const { return index; }
+  };
+
+  using iterator = const_iterator;
+  using value_type = var;
+
+  Sequence();
+
+  // Copies start without an index. A copy of a slice shares its storage
+  Sequence(const Sequence& other);
+  Sequence(Sequence&& other) noexcept;
+  Sequence& operator=(const Sequence& other);
+  Sequence& operator=(Sequence&& other) noexcept;
+  ~Sequence();
+
+  // Unboxed when the elements allow it
+  Sequence(const std::vector<var>& elements);  // NOLINT
+
+  template <typename InputIt>
+  Sequence(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+  }
+
+  inline Layout layout() const { return static_cast<Layout>(storage().index()); }
+
+  inline bool isBoxed() const { return layout() == Layout::Boxed; }
+
+  inline std::size_t size() const {
+    return _shared ? _count : std::visit([](const auto& items) { return items.size(); }, _items);
+  }
+
+  inline bool empty() const { return size() == 0; }
+
+  inline const_iterator begin() const { return const_iterator(this, 0); }
+
+  inline const_iterator end() const { return const_iterator(this, size()); }
+
+  // Element at a position, which must be in range
+  inline var operator[](std::size_t index) const {
+    const Items& items = storage();
+    if (_shared) {
+      index += _start;
+    }
+    switch (static_cast<Layout>(items.index())) {
+      case Layout::Integer: return var(std::get<0>(items)[index]);
+      case Layout::Double: return var(std::get<1>(items)[index]);
+      default: return std::get<2>(items)[index];
+    }
+  }
+
+  // Stored vars of a boxed sequence
+  inline std::span<const var> items() const { return window<2>(); }
+
+  // Stored var at a position, to be changed in place, or null when unboxed
+  // (numbers are never changed in place)
+  var* slot(std::size_t index);
+
+  // Unboxed elements, for the layout in use
+  inline std::span<const int32_t> integers() const { return window<0>(); }
+  inline std::span<const double> reals() const { return window<1>(); }
+
+  void reserve(std::size_t count);
+
+  void clear();
+
+  void push_back(const var& element);
+
+  // Append every element of `other`, which may be this same sequence
+  void append(const Sequence& other);
+
+  const_iterator insert(const_iterator position, const var& element);
+
+  const_iterator erase(const_iterator position);
+
+  // Elements from `start` up to `end`, sharing storage with this sequence
+  // until either changes. Short slices are copied
+  Sequence slice(std::size_t start, std::size_t end) const;
+
+  // First position at or after `from` holding an element equal to `query`, or npos
+  std::size_t find(const var& query, std::size_t from = 0) const;
+
+  // Stable ascending sort, by `key` of each element when given (computed once
+  // per element), see SortKernels
+  void sort(const Key& key = Key());
+
+  // Reductions of a non-empty unboxed sequence, see NumericKernels. Long
+  // sequences are reduced in fixed chunks, on the thread pool past its cutoff,
+  // so the same numbers give the same sum whatever the number of threads
+  var sum() const;
+  var min() const;
+  var max() const;
+
+  bool operator==(const Sequence& other) const;
+
+  // Lexicographic, like Python sequences: the first elements that are not
+  // equivalent decide, or else the shorter sequence comes first
+  std::partial_ordering compare(const Sequence& other) const;
+};
+
+// Container template for Collection
+template <typename T>
+using SequenceStorage = Sequence;
@@ -3,22 +3,12 @@
 
 #include <string>
 
-// ------------------ Private methods ------------------
-void Set::init() {
-  _methods["add"] = std::bind(&Set::add, this, std::placeholders::_1);
-  _methods["has"] = std::bind(&Set::has, this, std::placeholders::_1);
-  _methods["union"] = std::bind(&Set::unionW, this, std::placeholders::_1);
-  _methods["intersection"] = std::bind(&Set::intersectionW, this, std::placeholders::_1);
-  _methods["difference"] = std::bind(&Set::differenceW, this, std::placeholders::_1);
-  _methods["__str__"] = std::bind(&Set::asString, this, std::placeholders::_1);
-}
-
 // ------------------ Constructors and destructor ------------------
-Set::Set() { init(); }
+Set::Set() {}
 
 // Copy-constructor
-Set::Set(const Set& other) : Collection<Set, std::unordered_set>(other) { init(); }
-Set::Set(const std::unordered_set<var>& elements) : Collection<Set, std::unordered_set>(elements) { init(); }
+Set::Set(const Set& other) : Collection<Set, SetStorage>(other) {}
+Set::Set(const SetStorage<var>& elements) : Collection<Set, SetStorage>(elements) {}
 
 // ------------------ Native overrides ------------------
 void Set::print(std::ostream& os) const {
@@ -33,26 +23,43 @@ void Set::print(std::ostream& os) const {
 }
 
 ObjectPtr Set::clone() const {
-    return std::make_shared<Set>(*this);
+    return makeRef<Set>(*this);
 }
 
 // ------------------ Native operators ------------------
 Set::operator ObjectPtr() {
-  return std::make_shared<Set>(*this);
+  return makeRef<Set>(*this);
 }
 
 bool Set::equals(const Object& other) const {
-  auto otherSet = dynamic_cast<const Set*>(&other);
+  auto otherSet = objectCast<Set>(&other);
   if (!otherSet) {
     return false;
   }
   return _elements == otherSet->_elements;
 }
 
+void Set::checkVersion(std::size_t expectedVersion) const {
+  if (getVersion() != expectedVersion) {
+    throw std::runtime_error("Set changed size during iteration");
+  }
+}
+
 // ------------------ Management Methods ------------------
-using Method = std::function<ObjectPtr(const std::vector<ObjectPtr>&)>;
+using Method = std::function<ObjectPtr(Args)>;
+
+const MethodTable& Set::getMethods() const {
+  static const MethodTable methods = MethodTable(Collection::getMethods())
+      .add(Methods::add, &Set::add, true)
+      .add(Methods::has, &Set::has)
+      .add(Methods::unionW, &Set::unionW)
+      .add(Methods::intersection, &Set::intersectionW)
+      .add(Methods::difference, &Set::differenceW)
+      .add(Methods::asString, &Set::asString);
+  return methods;
+}
 
-Method::result_type Set::add(const std::vector<ObjectPtr>& params) {
+Method::result_type Set::add(Args params) {
   if (params.size() != 1) {
     throw std::runtime_error("add: Invalid number of arguments");
   }
@@ -60,56 +67,58 @@ Method::result_type Set::add(const std::vector<ObjectPtr>& params) {
   return nullptr;
 }
 
-Method::result_type Set::has(const std::vector<ObjectPtr>& params) {
+Method::result_type Set::has(Args params) {
   if (params.size() != 1) {
     throw std::runtime_error("has: Invalid number of arguments");
   }
-  auto elementToFind = var(params[0]);
-  auto result = Boolean(
-    (elementToFind)? _elements.find(elementToFind) != _elements.end() : false
-  );  // NOLINT
+  bool found = params[0] && _elements.find(*params[0]) != _elements.end();
 
-  return std::make_shared<Boolean>(result);
+  return Boolean::of(found);
 }
 
-Method::result_type Set::remove(const std::vector<ObjectPtr>& params) {
+Method::result_type Set::remove(Args params) {
   if (params.size() != 1) {
     throw std::runtime_error("remove: Invalid number of arguments");
   }
-  _elements.erase(params[0]);
+  if (params[0]) {
+    auto it = _elements.find(*params[0]);
+    if (it != _elements.end()) {
+      _elements.erase(it);
+    }
+  }
   return nullptr;
 }
 
-Method::result_type Set::unionW(const std::vector<ObjectPtr>& params) {
+Method::result_type Set::unionW(Args params) {
   if (params.size() != 1) {
     throw std::runtime_error("union: Invalid number of arguments");
   }
 
-  const Set* set = dynamic_cast<const Set*>(params[0].get());
+  const Set* set = objectCast<Set>(params[0].get());
   if (!set) {
     std::cerr << "union: Parameter must be Set";
     return nullptr;
   }
 
-  std::unordered_set<var> result = this->_elements;
+  SetStorage<var> result = this->_elements;
   result.insert(set->_elements.begin(), set->_elements.end());
 
-  return std::make_shared<Set>(result);
+  return makeRef<Set>(result);
 }
 
-Method::result_type Set::intersectionW(const std::vector<ObjectPtr>& params) {
+Method::result_type Set::intersectionW(Args params) {
   if (params.size() != 1) {
     throw std::runtime_error("intersection: Invalid number of arguments");
   }
 
-    const Set* other = dynamic_cast<const Set*>(params[0].get());
+    const Set* other = objectCast<Set>(params[0].get());
 
     if (!other) {
       std::cerr << "intersection: Parameter must be Set";
       return nullptr;
     }
 
-  std::unordered_set<var> result;
+  SetStorage<var> result;
 
   for (const var& element : this->_elements) {
     if (other->_elements.contains(element)) {
@@ -117,22 +126,22 @@ Method::result_type Set::intersectionW(const std::vector<ObjectPtr>& params) {
     }
   }
 
-  return std::make_shared<Set>(result);
+  return makeRef<Set>(result);
 }
 
-Method::result_type Set::differenceW(const std::vector<ObjectPtr>& params) {
+Method::result_type Set::differenceW(Args params) {
   if (params.size() != 1) {
     throw std::runtime_error("difference: Invalid number of arguments");
   }
 
-  const Set* other = dynamic_cast<const Set*>(params[0].get());
+  const Set* other = objectCast<Set>(params[0].get());
 
   if (!other) {
     std::cerr << "difference: Parameter must be Set";
     return nullptr;
   }
 
-  std::unordered_set<var> result;
+  SetStorage<var> result;
 
   for (const var& element : this->_elements) {
     if (!other->_elements.contains(element)) {
@@ -140,11 +149,11 @@ Method::result_type Set::differenceW(const std::vector<ObjectPtr>& params) {
     }
   }
 
-  return std::make_shared<Set>(result);
+  return makeRef<Set>(result);
 }
 
 // Get string representation of set
-Object::Method::result_type Set::asString(const std::vector<ObjectPtr>& params) {
+Object::Method::result_type Set::asString(Args params) {
   if (params.size() != 0) {
     throw std::runtime_error("__str__: Invalid number of arguments");
   }
@@ -154,11 +163,11 @@ Object::Method::result_type Set::asString(const std::vector<ObjectPtr>& params)
 
   for (auto it = _elements.begin(); it != _elements.end(); ++it) {
     if (
-      auto stringPtr = std::dynamic_pointer_cast<String>(
-        (*it)->Call("__str__", {})
+      auto stringPtr = objectCast<String>(
+        (*it)->Call(Methods::asString, {})
       )
     ) {
-      result.append(stringPtr->getValue());
+      result.append(stringPtr->view());
 
       if (std::next(it) != _elements.end()) {
         result.append(", ");
@@ -168,5 +177,5 @@ Object::Method::result_type Set::asString(const std::vector<ObjectPtr>& params)
 
   result.append("}");
 
-  return std::make_shared<String>(result);
+  return makeRef<String>(result);
 }
\ No newline at end of file
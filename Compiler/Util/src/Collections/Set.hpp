@@ -1,61 +1,72 @@
-// Copyright (c) 2024 Syntax Errors.
-#pragma once
-
-#include <unordered_set>
-#include <initializer_list>
-#include <iostream>
-#include <memory>
-#include <vector>
-#include <functional>
-#include "../Collections/Collection.hpp"
-
-class Set : public Collection<Set, std::unordered_set> {
- private:
-  void init();
-
- public:
-  // Default constructor
-  Set();
-
-  // Copy-constructor
-  Set(const Set& other);
-  implicit Set(const std::unordered_set<var>& elements);
-
-  ~Set() override = default;
-
-  // ------------------ Native overrides ------------------
-
-  // Print set contents
-  void print(std::ostream& os) const override;
-
-  // Clone self
-  ObjectPtr clone() const override;
-
-    // ------------------ Native operators ------------------
-
-  operator ObjectPtr() override;
-
-  bool equals(const Object& other) const override;
-
-  // ------------------ Management Methods ------------------
-  // Add element to set
-  Method::result_type add(const std::vector<ObjectPtr>& params);
-
-  // Lookup an element in set
-  Method::result_type has(const std::vector<ObjectPtr>& params);
-
-  // Remove specified element from set
-  Method::result_type remove(const std::vector<ObjectPtr>& params) override;
-
-  // Return union of self and another set
-  Method::result_type unionW(const std::vector<ObjectPtr>& params);
-
-  // Return intersection of self and another set
-  Method::result_type intersectionW(const std::vector<ObjectPtr>& params);
-
-  // Difference between this set (lhs) and another set (rhs)
-  Method::result_type differenceW(const std::vector<ObjectPtr>& params);
-
-  // Get string representation of set
-  Method::result_type asString(const std::vector<ObjectPtr>& params);
-};
+// Copyright (c) 2024 Syntax Errors.
+#pragma once
+
+#include <initializer_list>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <functional>
+#include "../Collections/Collection.hpp"
+#include "../Collections/FlatSet.hpp"
+
+// Elements live inline in a flat hash table probed by control-byte groups
+template <typename T>
+using SetStorage = FlatSet<T>;
+
+class Set : public Collection<Set, SetStorage> {
+ public:
+  static constexpr TypeTag tag = TypeTag::Set;
+
+  // Default constructor
+  Set();
+
+  // Copy-constructor
+  Set(const Set& other);
+  implicit Set(const SetStorage<var>& elements);
+
+  ~Set() override = default;
+
+  // ------------------ Native overrides ------------------
+
+  // Print set contents
+  void print(std::ostream& os) const override;
+
+  // Clone self
+  ObjectPtr clone() const override;
+
+    // ------------------ Native operators ------------------
+
+  operator ObjectPtr() override;
+
+  bool equals(const Object& other) const override;
+
+  // Changes whenever elements are inserted or removed
+  inline std::size_t getVersion() const { return _elements.version(); }
+  // Fail if the set changed since iteration started at `expectedVersion`
+  void checkVersion(std::size_t expectedVersion) const;
+
+  // ------------------ Management Methods ------------------
+  // Methods supported by sets
+  const MethodTable& getMethods() const override;
+
+  // Add element to set
+  Method::result_type add(Args params);
+
+  // Lookup an element in set
+  Method::result_type has(Args params);
+
+  // Remove specified element from set
+  Method::result_type remove(Args params) override;
+
+  // Return union of self and another set
+  Method::result_type unionW(Args params);
+
+  // Return intersection of self and another set
+  Method::result_type intersectionW(Args params);
+
+  // Difference between this set (lhs) and another set (rhs)
+  Method::result_type differenceW(Args params);
+
+  // Get string representation of set
+  Method::result_type asString(Args params);
+};
@@ -0,0 +1,133 @@
+// Copyright (c) 2024 Syntax Errors.
+#include <array>
+#include <cmath>
+#include <functional>
+
+#include "./SortKernels.hpp"
+#include "../Object/tasks.hpp"
+
+namespace {
+    // Integers at least this many are sorted by radix instead of by merging
+    constexpr std::size_t radixMinimum = 256;
+
+    // Least significant digit radix sort a byte at a time. Flipping the sign
+    // bit orders negative numbers first as unsigned keys
+    void radixSort(int32_t* data, std::size_t size) {
+        constexpr uint32_t signBit = 0x80000000u;
+        std::vector<uint32_t> keys(size);
+        std::vector<uint32_t> scratch(size);
+        for (std::size_t index = 0; index < size; ++index) {
+            keys[index] = static_cast<uint32_t>(data[index]) ^ signBit;
+        }
+
+        std::array<std::array<std::size_t, 256>, 4> counts{};
+        for (uint32_t key : keys) {
+            for (std::size_t digit = 0; digit < 4; ++digit) {
+                ++counts[digit][(key >> (digit * 8)) & 0xFF];
+            }
+        }
+
+        for (std::size_t digit = 0; digit < 4; ++digit) {
+            std::array<std::size_t, 256>& count = counts[digit];
+            // Every key has the same byte here, nothing would move
+            if (count[(keys[0] >> (digit * 8)) & 0xFF] == size) {
+                continue;
+            }
+
+            std::size_t offset = 0;
+            for (std::size_t& bucket : count) {
+                std::size_t next = offset + bucket;
+                bucket = offset;
+                offset = next;
+            }
+            for (uint32_t key : keys) {
+                scratch[count[(key >> (digit * 8)) & 0xFF]++] = key;
+            }
+            keys.swap(scratch);
+        }
+
+        for (std::size_t index = 0; index < size; ++index) {
+            data[index] = static_cast<int32_t>(keys[index] ^ signBit);
+        }
+    }
+
+    void sortSerial(int32_t* data, std::size_t size) {
+        if (size < radixMinimum) {
+            SortKernels::timsort(data, size, std::less<int32_t>());
+            return;
+        }
+
+        // Input that is one run already, either way, needs no radix passes
+        std::less<int32_t> less;
+        if (SortKernels::countRun(data, size, less) == size) {
+            return;
+        }
+        radixSort(data, size);
+    }
+
+    void sortSerial(double* data, std::size_t size) {
+        SortKernels::timsort(data, size, std::less<double>());
+    }
+
+    // Sort one slice per thread on the pool, then merge neighbouring slices
+    // in parallel rounds. Merges are stable, so the result is the same as
+    // sorting serially whatever the number of threads
+    template <typename T>
+    void sortParallel(T* data, std::size_t size) {
+        const std::size_t slices = Tasks::settings().threads;
+        std::vector<std::size_t> bounds(slices + 1);
+        for (std::size_t slice = 0; slice <= slices; ++slice) {
+            bounds[slice] = slice * size / slices;
+        }
+
+        Tasks::parallelFor(slices, [&](std::size_t slice) {
+            sortSerial(data + bounds[slice], bounds[slice + 1] - bounds[slice]);
+        });
+
+        std::vector<T> buffer(size);
+        T* from = data;
+        T* to = buffer.data();
+        while (bounds.size() > 2) {
+            const std::size_t runs = bounds.size() - 1;
+            Tasks::parallelFor((runs + 1) / 2, [&](std::size_t pair) {
+                const std::size_t low = bounds[2 * pair];
+                const std::size_t middle = bounds[std::min(2 * pair + 1, runs)];
+                const std::size_t high = bounds[std::min(2 * pair + 2, runs)];
+                std::merge(from + low, from + middle, from + middle, from + high, to + low);
+            });
+
+            std::vector<std::size_t> merged;
+            for (std::size_t index = 0; index < bounds.size(); index += 2) {
+                merged.push_back(bounds[index]);
+            }
+            if (merged.back() != size) {
+                merged.push_back(size);
+            }
+            bounds.swap(merged);
+            std::swap(from, to);
+        }
+
+        if (from != data) {
+            std::copy(from, from + size, data);
+        }
+    }
+}
+
+namespace SortKernels {
+    void sort(int32_t* data, std::size_t size) {
+        if (Tasks::worthSplitting(size)) {
+            sortParallel(data, size);
+        } else {
+            sortSerial(data, size);
+        }
+    }
+
+    void sort(double* data, std::size_t size) {
+        // NaN is unordered, where it ends up depends on how the work is split
+        if (Tasks::worthSplitting(size) && std::none_of(data, data + size, [](double value) { return std::isnan(value); })) {
+            sortParallel(data, size);
+        } else {
+            sortSerial(data, size);
+        }
+    }
+}
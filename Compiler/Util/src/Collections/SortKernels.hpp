@@ -0,0 +1,190 @@
+// Copyright (c) 2024 Syntax Errors.
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+// Sorting behind sorted() and list.sort() (see Collections/Sequence.cpp).
+// Every sort is stable and adaptive: runs already in order are found and
+// merged as they are, Timsort-style, instead of being sorted again
+namespace SortKernels {
+    // Runs shorter than this are extended with binary insertion sort
+    constexpr std::size_t minimumMerge = 32;
+
+    // Ascending order for the numbers themselves. Integers take a radix sort
+    // when long enough, reals are compared with < like Python does. Large
+    // buffers are split across the thread pool (see Object/tasks.hpp)
+    void sort(int32_t* data, std::size_t size);
+    void sort(double* data, std::size_t size);
+
+    // Length of the run starting at `data`, which is made ascending if it was
+    // strictly descending (so reversing it keeps equal elements in order)
+    template <typename T, typename Less>
+    std::size_t countRun(T* data, std::size_t size, Less& less) {
+        if (size < 2) {
+            return size;
+        }
+
+        std::size_t length = 2;
+        if (less(data[1], data[0])) {
+            while (length < size && less(data[length], data[length - 1])) {
+                ++length;
+            }
+            std::reverse(data, data + length);
+        } else {
+            while (length < size && !less(data[length], data[length - 1])) {
+                ++length;
+            }
+        }
+        return length;
+    }
+
+    // Sort `data` by inserting each element after the first `sorted` ones
+    template <typename T, typename Less>
+    void insertionSort(T* data, std::size_t size, std::size_t sorted, Less& less) {
+        for (std::size_t index = std::max<std::size_t>(sorted, 1); index < size; ++index) {
+            T pivot = std::move(data[index]);
+            T* position = std::upper_bound(data, data + index, pivot, less);
+            std::move_backward(position, data + index, data + index + 1);
+            *position = std::move(pivot);
+        }
+    }
+
+    // Run length below which runs are extended, so there are close to a power
+    // of two runs of about equal length to merge
+    inline std::size_t minimumRun(std::size_t size) {
+        std::size_t odd = 0;
+        while (size >= minimumMerge) {
+            odd |= size & 1;
+            size >>= 1;
+        }
+        return size + odd;
+    }
+
+    template <typename T, typename Less>
+    class Merger {
+     private:
+        struct Run {
+            std::size_t start;
+            std::size_t length;
+        };
+
+        T* data;
+        Less& less;
+        std::vector<Run> runs;
+        std::vector<T> buffer;
+
+        // Merge with the left run moved aside, filling from the front
+        void mergeLow(T* left, std::size_t leftLength, T* right, std::size_t rightLength) {
+            buffer.assign(std::make_move_iterator(left), std::make_move_iterator(left + leftLength));
+
+            T* output = left;
+            T* pending = buffer.data();
+            T* pendingEnd = pending + leftLength;
+            T* rightEnd = right + rightLength;
+            while (pending != pendingEnd && right != rightEnd) {
+                *output++ = less(*right, *pending) ? std::move(*right++) : std::move(*pending++);
+            }
+            // Whatever is left of the right run is already in place
+            std::move(pending, pendingEnd, output);
+        }
+
+        // Merge with the right run moved aside, filling from the back
+        void mergeHigh(T* left, std::size_t leftLength, T* right, std::size_t rightLength) {
+            buffer.assign(std::make_move_iterator(right), std::make_move_iterator(right + rightLength));
+
+            T* output = right + rightLength;
+            T* leftEnd = left + leftLength;
+            T* pending = buffer.data() + rightLength;
+            while (leftEnd != left && pending != buffer.data()) {
+                *--output = less(*(pending - 1), *(leftEnd - 1)) ? std::move(*--leftEnd) : std::move(*--pending);
+            }
+            std::move_backward(buffer.data(), pending, output);
+        }
+
+        // Merge runs `at` and `at + 1`
+        void mergeAt(std::size_t at) {
+            T* left = data + runs[at].start;
+            std::size_t leftLength = runs[at].length;
+            T* right = data + runs[at + 1].start;
+            std::size_t rightLength = runs[at + 1].length;
+
+            runs[at].length += rightLength;
+            runs.erase(runs.begin() + at + 1);
+
+            // Elements of the left run up to the first of the right one stay
+            // where they are, and so do those of the right run after the last
+            // of the left one
+            T* first = std::upper_bound(left, left + leftLength, *right, less);
+            leftLength -= first - left;
+            left = first;
+            if (leftLength == 0) {
+                return;
+            }
+            rightLength = std::lower_bound(right, right + rightLength, left[leftLength - 1], less) - right;
+            if (rightLength == 0) {
+                return;
+            }
+
+            if (leftLength <= rightLength) {
+                mergeLow(left, leftLength, right, rightLength);
+            } else {
+                mergeHigh(left, leftLength, right, rightLength);
+            }
+        }
+
+     public:
+        Merger(T* data, Less& less) : data(data), less(less) {}
+
+        // Add the next run and merge until run lengths shrink fast enough
+        // that merges stay balanced
+        void push(std::size_t start, std::size_t length) {
+            runs.push_back(Run{start, length});
+            while (runs.size() > 1) {
+                std::size_t at = runs.size() - 2;
+                if ((at > 0 && runs[at - 1].length <= runs[at].length + runs[at + 1].length)
+                    || (at > 1 && runs[at - 2].length <= runs[at - 1].length + runs[at].length)) {
+                    if (runs[at - 1].length < runs[at + 1].length) {
+                        --at;
+                    }
+                } else if (runs[at].length > runs[at + 1].length) {
+                    break;
+                }
+                mergeAt(at);
+            }
+        }
+
+        void finish() {
+            while (runs.size() > 1) {
+                mergeAt(runs.size() - 2);
+            }
+        }
+    };
+
+    // Stable adaptive merge sort. `less` must be cheap to call and must not
+    // throw once elements own resources, sort positions or views otherwise
+    template <typename T, typename Less>
+    void timsort(T* data, std::size_t size, Less less) {
+        if (size < 2) {
+            return;
+        }
+
+        const std::size_t minRun = minimumRun(size);
+        Merger<T, Less> merger(data, less);
+        for (std::size_t start = 0; start < size; ) {
+            std::size_t length = countRun(data + start, size - start, less);
+            if (length < minRun) {
+                const std::size_t extended = std::min(minRun, size - start);
+                insertionSort(data + start, extended, length, less);
+                length = extended;
+            }
+            merger.push(start, length);
+            start += length;
+        }
+        merger.finish();
+    }
+}
@@ -5,28 +5,13 @@
 #include "Tuple.hpp"
 #include "../Object/object.hpp"
 
-void Tuple::init() {
-  _methods.erase("pop");
-  _methods.erase("clear");
-  _methods.erase("remove");
-  _methods["slice"] = std::bind(&Tuple::slice, this, std::placeholders::_1);
-  _methods["index"] = std::bind(&Tuple::index, this, std::placeholders::_1);
-  _methods["__str__"] = std::bind(&Tuple::asString, this, std::placeholders::_1);
-}
-
 // Default constructor
-Tuple::Tuple() {
-  init();
-}
+Tuple::Tuple() {}
 
 // Copy-constructor
-Tuple::Tuple(const Tuple& other) : Collection<Tuple, std::vector>(other) {
-  init();
-}
+Tuple::Tuple(const Tuple& other) : Collection<Tuple, SequenceStorage>(other) {}
 
-Tuple::Tuple(const std::vector<var>& _elements) : Collection<Tuple, std::vector>(_elements) {
-  init();
-}
+Tuple::Tuple(Sequence elements) : Collection<Tuple, SequenceStorage>(std::move(elements)) {}
 
 // ------------------ Native overrides ------------------
 // Print contents
@@ -43,55 +28,51 @@ void Tuple::print(std::ostream& os) const {
 
 // Clone self
 ObjectPtr Tuple::clone() const {
-  return std::make_shared<Tuple>(*this);
+  return makeRef<Tuple>(*this);
 }
 
 // ------------------ Native operators ------------------
 Tuple::operator ObjectPtr() {
-  return std::make_shared<Tuple>(*this);
+  return makeRef<Tuple>(*this);
 };
 
-bool Tuple::equals(const Object& other) const {
-  auto otherTuple = dynamic_cast<const Tuple*>(&other);
-  if (!otherTuple) { return false; }
-
-  return _elements == otherTuple->_elements;
+std::size_t Tuple::hash() const {
+  return _hash.get([this] { return Collection::hash(); });
 }
 
-bool Tuple::less(const Object& other) const {
-  auto otherTuple = dynamic_cast<const Tuple*>(&other);
+bool Tuple::equals(const Object& other) const {
+  auto otherTuple = objectCast<Tuple>(&other);
   if (!otherTuple) { return false; }
 
-  return this->_elements < otherTuple->_elements;
+  return _elements == otherTuple->_elements;
 }
 
-bool Tuple::greater(const Object& other) const {
-  auto otherTuple = dynamic_cast<const Tuple*>(&other);
-  if (!otherTuple) { return false; }
+std::partial_ordering Tuple::compare(const Object& other) const {
+  auto otherTuple = objectCast<Tuple>(&other);
+  if (!otherTuple) { return std::partial_ordering::unordered; }
 
-  return this->_elements > otherTuple->_elements;
+  return this->_elements.compare(otherTuple->_elements);
 }
 
 // Return a tuple with _elements from both tuples (self, then other's)
 ObjectPtr Tuple::add(const Object& other) const {
-  auto otherTuple = dynamic_cast<const Tuple*>(&other);
+  auto otherTuple = objectCast<Tuple>(&other);
 
   if (!otherTuple) {
     std::cerr << "Invalid argument type, expected Tuple.\n";
     return nullptr;
   }
 
-  std::vector<var> result = this->_elements;
-  result.insert(
-    result.end(), otherTuple->_elements.begin(), otherTuple->_elements.end());
+  Sequence result = this->_elements;
+  result.append(otherTuple->_elements);
 
-  return std::make_shared<Tuple>(result);
+  return makeRef<Tuple>(std::move(result));
 }
 
 
 // Access a given element on the collection by index
 ObjectPtr Tuple::subscript(const Object& other) const {
-  auto otherObj = dynamic_cast<const Integer*>(&other);
+  auto otherObj = objectCast<Integer>(&other);
 
   if (!otherObj) {
     std::cerr << "Invalid index type, expected Integer.\n";
@@ -108,35 +89,60 @@ ObjectPtr Tuple::subscript(const Object& other) const {
   return _elements[index].getValue();
 }
 
-ObjectPtr Tuple::slice(const std::vector<ObjectPtr>& params) {
+ObjectPtr Tuple::slice(Args params) {
+  SliceBounds bounds = sliceBounds(_elements.size(), params);
+  if (bounds.step == 1) {
+    return makeRef<Tuple>(_elements.slice(bounds.start, bounds.end));
+  }
+
   return generalizedSlice(
     _elements,
     params,
-    [](std::vector<var>& result, const var& element) { result.push_back(element); },
-    [](const std::vector<var>& resultContainer) {
-      return std::make_shared<Tuple>(resultContainer);
+    [](Sequence& result, const var& element) { result.push_back(element); },
+    [](Sequence& resultContainer) {
+      return makeRef<Tuple>(std::move(resultContainer));
     });
 }
 
 // ------------------ Management methods ------------------
+// Tuples are immutable, so mutating collection methods are dropped
+const MethodTable& Tuple::getMethods() const {
+  static const MethodTable methods = MethodTable(Collection::getMethods())
+      .erase(Methods::pop)
+      .erase(Methods::clear)
+      .erase(Methods::remove)
+      .add(Methods::slice, &Tuple::slice)
+      .add(Methods::index, &Tuple::index)
+      .add(Methods::has, &Tuple::has)
+      .add(Methods::asString, &Tuple::asString);
+  return methods;
+}
+
 // Return index of first ocurrence of element
-Object::Method::result_type Tuple::index(const std::vector<ObjectPtr>& params) {
+Object::Method::result_type Tuple::index(Args params) {
   if (params.size() != 1) {
     throw std::runtime_error("index: Invalid number of arguments");
   }
 
-  var query = params[0];
-  for (size_t i = 0; i < _elements.size(); ++i) {
-    if (_elements[i] == query) {
-      return std::make_shared<Integer>(i);
-    }
+  std::size_t position = _elements.find(var(params[0]));
+  if (position != Sequence::npos) {
+    return Integer::of(position);
   }
 
   std::cerr << "index: Value missing from list" << std::endl;
   return nullptr;
 }
 
-Object::Method::result_type Tuple::asString(const std::vector<ObjectPtr>& params) {
+// Whether an element is in the tuple
+Object::Method::result_type Tuple::has(Args params) {
+  if (params.size() != 1) {
+    throw std::runtime_error("has: Invalid number of arguments");
+  }
+
+  return Boolean::of(_elements.find(var(params[0])) != Sequence::npos);
+}
+
+Object::Method::result_type Tuple::asString(Args params) {
   if (params.size() != 0) {
     throw std::runtime_error("__str__: Invalid number of arguments");
   }
@@ -146,11 +152,11 @@ Object::Method::result_type Tuple::asString(const std::vector<ObjectPtr>& params
 
   for (size_t i = 0; i < _elements.size(); ++i) {
     if (
-      auto stringPtr = std::dynamic_pointer_cast<String>(
-        _elements[i]->Call("__str__", {})
+      auto stringPtr = objectCast<String>(
+        _elements[i]->Call(Methods::asString, {})
       )
     ) {
-      result.append(stringPtr->getValue());
+      result.append(stringPtr->view());
 
       if (i + 1 != _elements.size()) {
         result.append(", ");
@@ -160,5 +166,5 @@ Object::Method::result_type Tuple::asString(const std::vector<ObjectPtr>& params
 
   result.append(")");
 
-  return std::make_shared<String>(result);
+  return makeRef<String>(result);
 }
@@ -9,18 +9,22 @@
 #include "./Object/var.hpp"
 
 #include "./Collection.hpp"
+#include "./Sequence.hpp"
 
-class Tuple : public Collection<Tuple, std::vector> {
+class Tuple : public Collection<Tuple, SequenceStorage> {
  private:
-  void init();
+  // Tuples are immutable, so their hash is only computed once
+  HashCache _hash;
 
  public:
+  static constexpr TypeTag tag = TypeTag::Tuple;
+
   // Default constructor
   Tuple();
 
   // Copy-constructor
   Tuple(const Tuple& other);
-  explicit Tuple(const std::vector<var>& elements);
+  explicit Tuple(Sequence elements);
 
   ~Tuple() override = default;
 
@@ -34,11 +38,11 @@ class Tuple : public Collection<Tuple, std::vector> {
   // ------------------ Native operators ------------------
   operator ObjectPtr() override;
 
-  bool equals(const Object& other) const override;
+  std::size_t hash() const override;
 
-  bool less(const Object& other) const override;
+  bool equals(const Object& other) const override;
 
-  bool greater(const Object& other) const override;
+  std::partial_ordering compare(const Object& other) const override;
 
   // Return a tuple with elements from both tuples (self, then other's)
   ObjectPtr add(const Object& other) const override;
@@ -46,14 +50,20 @@ class Tuple : public Collection<Tuple, std::vector> {
   // Access a given element on the collection by index
   ObjectPtr subscript(const Object& other) const override;
 
-  Method::result_type slice(const std::vector<ObjectPtr>& params);
+  Method::result_type slice(Args params);
   // ------------------ Management methods ------------------
+  // Methods supported by tuples
+  const MethodTable& getMethods() const override;
+
   // Return sliced tuple
-  // Method::result_type slice(const std::vector<ObjectPtr>& params);
+  // Method::result_type slice(Args params);
   
   // Return index of first ocurrence of element
-  Object::Method::result_type index(const std::vector<ObjectPtr>& params);
+  Object::Method::result_type index(Args params);
+
+  // Whether an element is in the tuple
+  Object::Method::result_type has(Args params);
 
   // Return string representation of tuple
-  Object::Method::result_type asString(const std::vector<ObjectPtr>& params);
+  Object::Method::result_type asString(Args params);
 };
@@ -0,0 +1,117 @@
+// Copyright (c) 2024 Syntax Errors.
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "./Arithmetic.hpp"
+#include "./Double.hpp"
+#include "./Integer.hpp"
+
+namespace {
+  using Operation = Arithmetic::Operation;
+  using BinaryOperation = ObjectPtr (*)(const Object&, const Object&);
+  using Comparison = std::partial_ordering (*)(const Object&, const Object&);
+
+  // Position of each numeric type in the dispatch matrices
+  constexpr std::size_t kNumericTypes = 2;
+  constexpr std::size_t kOperations = 4;
+
+  inline int slot(TypeTag type) {
+    switch (type) {
+      case TypeTag::Integer: return 0;
+      case TypeTag::Double: return 1;
+      default: return -1;
+    }
+  }
+
+  const char* operationName(Operation operation) {
+    switch (operation) {
+      case Operation::Add: return "Addition";
+      case Operation::Subtract: return "Subtraction";
+      case Operation::Multiply: return "Multiplication";
+      default: return "Division";
+    }
+  }
+
+  // Division that refuses integer division by zero
+  struct Divides {
+    template <typename Lhs, typename Rhs>
+    auto operator()(Lhs lhs, Rhs rhs) const {
+      if constexpr (std::is_integral_v<Lhs> && std::is_integral_v<Rhs>) {
+        if (rhs == 0) {
+          throw std::runtime_error("Division by zero");
+        }
+      }
+      return lhs / rhs;
+    }
+  };
+
+  template <typename Lhs, typename Rhs, typename Operator>
+  ObjectPtr compute(const Object& lhs, const Object& rhs) {
+    using Result = std::conditional_t<
+      std::is_same_v<Lhs, Integer> && std::is_same_v<Rhs, Integer>, Integer, Double>;
+
+    auto result = Operator{}(
+      static_cast<const Lhs&>(lhs).getValue(), static_cast<const Rhs&>(rhs).getValue());
+
+    if constexpr (std::is_same_v<Result, Integer>) {
+      return Integer::of(result);
+    } else {
+      return makeRef<Result>(result);
+    }
+  }
+
+  template <typename Lhs, typename Rhs>
+  std::partial_ordering compareAs(const Object& lhs, const Object& rhs) {
+    return static_cast<const Lhs&>(lhs).getValue() <=> static_cast<const Rhs&>(rhs).getValue();
+  }
+
+  #define NUMERIC_ROW(OPERATOR) \
+    { \
+      { &compute<Integer, Integer, OPERATOR>, &compute<Integer, Double, OPERATOR> }, \
+      { &compute<Double, Integer, OPERATOR>, &compute<Double, Double, OPERATOR> } \
+    }
+
+  // Indexed by operation, lhs slot and rhs slot
+  constexpr BinaryOperation kOperators[kOperations][kNumericTypes][kNumericTypes] = {
+    NUMERIC_ROW(std::plus<>),
+    NUMERIC_ROW(std::minus<>),
+    NUMERIC_ROW(std::multiplies<>),
+    NUMERIC_ROW(Divides),
+  };
+
+  #undef NUMERIC_ROW
+
+  // Indexed by lhs slot and rhs slot
+  constexpr Comparison kComparisons[kNumericTypes][kNumericTypes] = {
+    { &compareAs<Integer, Integer>, &compareAs<Integer, Double> },
+    { &compareAs<Double, Integer>, &compareAs<Double, Double> },
+  };
+}
+
+namespace Arithmetic {
+  ObjectPtr apply(Operation operation, const Object& lhs, const Object& rhs) {
+    int lhsSlot = slot(lhs.type());
+    int rhsSlot = slot(rhs.type());
+
+    if (lhsSlot < 0 || rhsSlot < 0) {
+      throw std::runtime_error(
+        std::string(operationName(operation)) + " not supported between "
+        + typeName(lhs.type()) + " and " + typeName(rhs.type()));
+    }
+
+    return kOperators[static_cast<std::size_t>(operation)][lhsSlot][rhsSlot](lhs, rhs);
+  }
+
+  std::partial_ordering compare(const Object& lhs, const Object& rhs) {
+    int lhsSlot = slot(lhs.type());
+    int rhsSlot = slot(rhs.type());
+
+    if (lhsSlot < 0 || rhsSlot < 0) {
+      return std::partial_ordering::unordered;
+    }
+
+    return kComparisons[lhsSlot][rhsSlot](lhs, rhs);
+  }
+}
@@ -0,0 +1,18 @@
+// Copyright (c) 2024 Syntax Errors.
+#pragma once
+
+#include <compare>
+#include <cstdint>
+
+#include "../Object/object.hpp"
+
+// Double dispatch of numeric operators by (lhs type, rhs type)
+namespace Arithmetic {
+  enum class Operation : uint8_t { Add, Subtract, Multiply, Divide };
+
+  // Apply operation between two numbers, promoting Integer to Double when mixed
+  ObjectPtr apply(Operation operation, const Object& lhs, const Object& rhs);
+
+  // Compare two numbers, unordered when either one is not a number
+  std::partial_ordering compare(const Object& lhs, const Object& rhs);
+}
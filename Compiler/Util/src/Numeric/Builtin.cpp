@@ -8,7 +8,7 @@
 
 // Implement orphan built in functions
 namespace Builtin {
-  var abs(const std::vector<ObjectPtr>& params) {
+  var abs(Args params) {
     if (params.size() != 1) {
       std::cerr << "abs: Invalid number of arguments\n";
       return nullptr;
@@ -17,15 +17,15 @@ namespace Builtin {
     ObjectPtr obj = params[0];
 
     if (
-        ! dynamic_cast<const Double*>(obj.get())
-        && ! dynamic_cast<const Integer*>(obj.get())
+        ! objectCast<Double>(obj.get())
+        && ! objectCast<Integer>(obj.get())
     )
     std::cerr << "Unexpected type. Expected Integer or Double\n";
 
-    return obj->Call("__abs__", {});
+    return obj->Call(Methods::abs, {});
   }
 
-  var round(const std::vector<ObjectPtr>& params) {
+  var round(Args params) {
     if (params.size() != 1) {
       std::cerr << "round: Invalid number of arguments\n";
       return nullptr;
@@ -34,16 +34,16 @@ namespace Builtin {
     ObjectPtr obj = params[0];
 
     {
-      auto doubleObj = dynamic_cast<const Double*>(obj.get());
+      auto doubleObj = objectCast<Double>(obj.get());
       if ( doubleObj ) { 
-        return (var) std::make_shared<Double>(std::round(doubleObj->getValue())); 
+        return (var) makeRef<Double>(std::round(doubleObj->getValue())); 
       }
     }
 
     {
-      auto integerObj = dynamic_cast<const Integer*>(obj.get());
+      auto integerObj = objectCast<Integer>(obj.get());
       if ( integerObj ) { 
-        return (var) integerObj; 
+        return (var) obj; 
       }
     }
 
@@ -51,7 +51,7 @@ namespace Builtin {
     return nullptr;
   }
 
-  var pow(const std::vector<ObjectPtr>& params) {
+  var pow(Args params) {
     if (params.size() < 2 || params.size() > 3) {
       std::cerr << "pow: Invalid number of arguments\n";
       return nullptr;
@@ -63,12 +63,12 @@ namespace Builtin {
     {
         ObjectPtr obj = params[0];
 
-        if (auto objNumeric = dynamic_cast<const Double*>(obj.get()) ) { 
+        if (auto objNumeric = objectCast<Double>(obj.get()) ) { 
             base = objNumeric->getValue();
             integerPow = false;
         }
 
-        else if (auto objNumeric = dynamic_cast<const Integer*>(obj.get()) ) { 
+        else if (auto objNumeric = objectCast<Integer>(obj.get()) ) { 
             base = objNumeric->getValue();
         }
 
@@ -82,12 +82,12 @@ namespace Builtin {
     {
         ObjectPtr obj = params[1];
 
-        if (auto objNumeric = dynamic_cast<const Double*>(obj.get()) ) { 
+        if (auto objNumeric = objectCast<Double>(obj.get()) ) { 
             exponent = objNumeric->getValue();
             integerPow = false;
         }
 
-        else if (auto objNumeric = dynamic_cast<const Integer*>(obj.get()) ) { 
+        else if (auto objNumeric = objectCast<Integer>(obj.get()) ) { 
             exponent = objNumeric->getValue();
         }
 
@@ -106,7 +106,7 @@ namespace Builtin {
 
         ObjectPtr obj = params[2];
 
-        if (auto objNumeric = dynamic_cast<const Integer*>(obj.get()) ) { 
+        if (auto objNumeric = objectCast<Integer>(obj.get()) ) { 
             auto passedModulo = objNumeric->getValue();
 
             if (passedModulo < 0) {
@@ -125,15 +125,15 @@ namespace Builtin {
         std::size_t result = std::pow(base, exponent);
         result %= modulo;
 
-        return (var) std::make_shared<Integer>(result);
+        return (var) Integer::of(result);
     }
 
-    return (var) std::make_shared<Double>(std::pow(base, exponent));
+    return (var) makeRef<Double>(std::pow(base, exponent));
   }
 
-  var asInteger(const std::vector<ObjectPtr>& params) {
+  var asInteger(Args params) {
     if (params.size() == 0) {
-        return (var) std::make_shared<Integer>(0);
+        return (var) Integer::of(0);
     }
 
     if (params.size() > 2) {
@@ -143,8 +143,8 @@ namespace Builtin {
 
     ObjectPtr obj = params[0];
     {
-        auto objDouble = dynamic_cast<const Double*>(obj.get());
-        auto objInteger = dynamic_cast<const Integer*>(obj.get());
+        auto objDouble = objectCast<Double>(obj.get());
+        auto objInteger = objectCast<Integer>(obj.get());
 
         if (objDouble || objInteger) {
             if (params.size() == 2) {
@@ -153,14 +153,14 @@ namespace Builtin {
             }
 
             if (objInteger) {
-                return (var) objInteger;
+                return (var) obj;
             }
 
-            return (var) std::make_shared<Integer>(objDouble->getValue());
+            return (var) Integer::of(objDouble->getValue());
         }
     }
 
-    auto objString = dynamic_cast<const String*>(obj.get());
+    auto objString = objectCast<String>(obj.get());
     if (! objString) {
         std::cerr << "Unexpected first parameter type. Expected String, Integer or Double.\n";
         return nullptr;
@@ -172,7 +172,7 @@ namespace Builtin {
 
     if (params.size() == 2) {
         ObjectPtr obj = params[1];
-        auto objInteger = dynamic_cast<const Integer*>(obj.get());
+        auto objInteger = objectCast<Integer>(obj.get());
 
         if (! objInteger) {
             std::cerr << "Unexpected second parameter type. Expected Integer.\n";
@@ -189,7 +189,7 @@ namespace Builtin {
 
     try {
         int32_t result = std::stoi(str, nullptr, base); 
-        return (var) std::make_shared<Integer>(result);
+        return (var) Integer::of(result);
     } catch (const std::exception& e) {
         std::cerr 
             << "Invalid integer conversion from String: "
@@ -201,9 +201,9 @@ namespace Builtin {
     return nullptr;
   }
 
-  var asDouble(const std::vector<ObjectPtr>& params) {
+  var asDouble(Args params) {
     if (params.size() == 0) {
-        return (var) std::make_shared<Double>(0.0);
+        return (var) makeRef<Double>(0.0);
     }
 
     if (params.size() > 1) {
@@ -213,20 +213,20 @@ namespace Builtin {
 
     ObjectPtr obj = params[0];
     
-    if (auto objDouble = dynamic_cast<const Double*>(obj.get())) {
-        return (var) objDouble;
+    if (objectCast<Double>(obj.get())) {
+        return (var) obj;
     }
 
-    if (auto objInteger = dynamic_cast<const Integer*>(obj.get())) {
-        return (var) std::make_shared<Double>(objInteger->getValue());
+    if (auto objInteger = objectCast<Integer>(obj.get())) {
+        return (var) makeRef<Double>(objInteger->getValue());
     }
 
-    if (auto objString = dynamic_cast<const String*>(obj.get())) {
+    if (auto objString = objectCast<String>(obj.get())) {
         const std::string& str = objString->getValue();
 
         try {
             double result = std::stod(str, nullptr);
-            return (var) std::make_shared<Double>(result);
+            return (var) makeRef<Double>(result);
         } catch (const std::exception& e) {
             std::cerr 
                 << "Invalid float conversion from String: "
@@ -6,17 +6,17 @@
 // Implement orphan built in functions
 namespace Builtin {
   // Get absolute value of number
-  var abs(const std::vector<ObjectPtr>& params);
+  var abs(Args params);
 
   // Get rounded number
-  var round(const std::vector<ObjectPtr>& params);
+  var round(Args params);
 
   // Get power from base raised to power, modulo
-  var pow(const std::vector<ObjectPtr>& params);
+  var pow(Args params);
 
   // Get interpretation as integer number
-  var asInteger(const std::vector<ObjectPtr>& params);
+  var asInteger(Args params);
 
   // Get interpretation as double-precision floating point number
-  var asDouble(const std::vector<ObjectPtr>& params);
+  var asDouble(Args params);
 }
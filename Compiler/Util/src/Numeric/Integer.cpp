@@ -1,72 +1,29 @@
 // Copyright (c) 2024 Syntax Errors.
 #include "./Integer.hpp"
-#include "./Double.hpp"
 
 Integer::Integer(int32_t value) : Numeric(value) {}
 
-Integer::operator ObjectPtr(){
-    return std::make_shared<Integer>(*this);
-};
-
-ObjectPtr Integer::addHelper(const Object& other) const {
-    auto otherObj = dynamic_cast<const Double*>(&other);
-    if (otherObj) {
-        return std::make_shared<Double>(value + otherObj->getValue());
-    }
-
-    throw std::runtime_error("Integer does not support addition with given type");
-}
-
-ObjectPtr Integer::subtractHelper(const Object& other) const {
-    auto otherObj = dynamic_cast<const Double*>(&other);
-    if (otherObj) {
-        return std::make_shared<Double>(value - otherObj->getValue());
-    }
-
-    throw std::runtime_error("Integer does not support subtraction with given type");
-}
-
-ObjectPtr Integer::multiplyHelper(const Object& other) const {
-    auto otherObj = dynamic_cast<const Double*>(&other);
-    if (otherObj) {
-        return std::make_shared<Double>(value + otherObj->getValue());
-    }
-
-    throw std::runtime_error("Integer does not support multiplication with given type");
-}
+// Same preallocated range as CPython
+constexpr int32_t smallIntegerMin = -5;
+constexpr int32_t smallIntegerMax = 256;
 
-ObjectPtr Integer::divideHelper(const Object& other) const {
-    auto otherObj = dynamic_cast<const Double*>(&other);
-    if (otherObj) {
-        return std::make_shared<Double>(value + otherObj->getValue());
+ObjectPtr Integer::of(int32_t value) {
+    if (value < smallIntegerMin || value > smallIntegerMax) {
+        return makeRef<Integer>(value);
     }
 
-    throw std::runtime_error("Integer does not support division with given type");
-}
-
-bool Integer::equalsHelper(const Object& other) const {
-    auto otherObj = dynamic_cast<const Double*>(&other);
-    if (otherObj) {
-        return value == otherObj->getValue();
-    }
+    static Integer* const* smallIntegers = [] {
+        static Integer* table[smallIntegerMax - smallIntegerMin + 1];
+        for (int32_t number = smallIntegerMin; number <= smallIntegerMax; ++number) {
+            table[number - smallIntegerMin] = new Integer(number);
+            table[number - smallIntegerMin]->makeImmortal();
+        }
+        return table;
+    }();
 
-    return false;
+    return ObjectPtr(smallIntegers[value - smallIntegerMin]);
 }
 
-bool Integer::lessHelper(const Object& other) const {
-    auto otherObj = dynamic_cast<const Double*>(&other);
-    if (otherObj) {
-        return value < otherObj->getValue();
-    }
-
-    return false;
-}
-
-bool Integer::greaterHelper(const Object& other) const {
-    auto otherObj = dynamic_cast<const Double*>(&other);
-    if (otherObj) {
-        return value > otherObj->getValue();
-    }
-
-    return false;
-}
+Integer::operator ObjectPtr(){
+    return Integer::of(value);
+};
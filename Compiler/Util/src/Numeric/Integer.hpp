@@ -7,21 +7,12 @@
 // TODO(Dwayne): Implement like division.
 class Integer : public Numeric<Integer, int32_t> {
 	public:
-		explicit Integer(int32_t value);
-
-		operator ObjectPtr() override;
-
-		ObjectPtr addHelper(const Object& other) const override;
-
-		ObjectPtr subtractHelper(const Object& other) const override;
+		static constexpr TypeTag tag = TypeTag::Integer;
 
-		ObjectPtr multiplyHelper(const Object& other) const override;
-
-		ObjectPtr divideHelper(const Object& other) const override;
-
-		bool equalsHelper(const Object& other) const override;
+		explicit Integer(int32_t value);
 
-		bool lessHelper(const Object& other) const override;
+		// Integer with the given value, shared and immortal within the small integer range
+		static ObjectPtr of(int32_t value);
 
-		bool greaterHelper(const Object& other) const override;
+		operator ObjectPtr() override;
 };
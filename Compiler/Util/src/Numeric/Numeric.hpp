@@ -5,55 +5,21 @@
 #include <iostream>
 
 #include "../Object/object.hpp"
+#include "./Arithmetic.hpp"
 #include "../Primitive/Boolean.hpp"
 #include "../Primitive/String.hpp"
 
 #define implicit
 #define unused [[maybe_unused]]
 
-// Arithmetic operation helper macro
-#define DEFINE_OPERATOR(OP_NAME, OP_SYMBOL, ERROR_MESSAGE) \
-  ObjectPtr OP_NAME(const Object& other) const override { \
-    auto otherObj = dynamic_cast<const Derived*>(&other); \
-    if (otherObj) { \
-      return std::make_shared<Derived>(value OP_SYMBOL otherObj->getValue()); \
-    } \
-    return OP_NAME##Helper(other); \
-  } \
-  \
-  virtual ObjectPtr OP_NAME##Helper(unused const Object& other) const { \
-      throw std::runtime_error(#ERROR_MESSAGE " not supported for different types"); \
-  }
-
-// Comparison operation helper macro
-#define DEFINE_COMPARISON_OPERATOR(OP_NAME, OP_SYMBOL, ERROR_MESSAGE) \
-  bool OP_NAME(const Object& other) const override { \
-    auto otherObj = dynamic_cast<const Derived*>(&other); \
-    if (otherObj) { \
-      return value OP_SYMBOL otherObj->getValue(); \
-    } \
-    return OP_NAME##Helper(other); \
-  } \
-  \
-  virtual bool OP_NAME##Helper(unused const Object& other) const { \
-      return false; \
-  }
-
 // Base template class for numeric objects
 template <typename Derived, typename ValueType>
 class Numeric : public Object {
- private: 
-  void init() {
-    _methods["__abs__"] = std::bind(&Numeric::abs, this, std::placeholders::_1);
-    _methods["__bool__"] = std::bind(&Numeric::asBoolean, this, std::placeholders::_1);
-    _methods["__str__"] = std::bind(&Numeric::asString, this, std::placeholders::_1);
-  }
-
  protected:
   ValueType value;
 
  public:
-  explicit Numeric(ValueType value) : value(std::move(value)) { init(); }
+  explicit Numeric(ValueType value) : Object(Derived::tag), value(std::move(value)) {}
   inline const ValueType& getValue() const { return value; }
   
   ~Numeric() override = default;
@@ -63,14 +29,14 @@ class Numeric : public Object {
   // Print inner number
   inline void print(std::ostream& os) const override {
     #ifdef DEBUG
-      os << typeid(Derived).name() << ": " << value;
+      os << typeName(Derived::tag) << ": " << value;
     #else
       os << value;
     #endif
   }
 
   inline ObjectPtr clone() const override {
-      return std::make_shared<Derived>(value);
+      return makeRef<Derived>(value);
   }
 
   // ------------------ Native operators ------------------
@@ -86,39 +52,58 @@ class Numeric : public Object {
   }
 
   // Arithmethic between numbers
-  DEFINE_OPERATOR(add, +, 'Addition')
-  DEFINE_OPERATOR(subtract, -, 'Subtraction')
-  DEFINE_OPERATOR(multiply, *, 'Multiplication')
-  DEFINE_OPERATOR(divide, /, 'Division')
+  ObjectPtr add(const Object& other) const override {
+    return Arithmetic::apply(Arithmetic::Operation::Add, *this, other);
+  }
+
+  ObjectPtr subtract(const Object& other) const override {
+    return Arithmetic::apply(Arithmetic::Operation::Subtract, *this, other);
+  }
+
+  ObjectPtr multiply(const Object& other) const override {
+    return Arithmetic::apply(Arithmetic::Operation::Multiply, *this, other);
+  }
+
+  ObjectPtr divide(const Object& other) const override {
+    return Arithmetic::apply(Arithmetic::Operation::Divide, *this, other);
+  }
 
-  // Comparison between numbers
-  DEFINE_COMPARISON_OPERATOR(equals, ==, 'Equality')
-  DEFINE_COMPARISON_OPERATOR(less, <, 'Less than')
-  DEFINE_COMPARISON_OPERATOR(greater, >, 'Greater than')
+  // Comparison between numbers, unordered against non-numeric types
+  std::partial_ordering compare(const Object& other) const override {
+    return Arithmetic::compare(*this, other);
+  }
 
   // ------------------ Management methods ------------------
 
-  virtual Method::result_type abs(const std::vector<ObjectPtr>& params) {
+  const MethodTable& getMethods() const override {
+    static const MethodTable methods = MethodTable()
+        .add(Methods::abs, &Numeric::abs)
+        .add(Methods::asBoolean, &Numeric::asBoolean)
+        .add(Methods::asString, &Numeric::asString);
+    return methods;
+  }
+
+  virtual Method::result_type abs(Args params) {
     if (params.size() != 0) {
       throw std::runtime_error("__abs__: Invalid number of arguments");
     }
 
-    return std::make_shared<Derived>(std::abs(this->value));
+    return makeRef<Derived>(std::abs(this->value));
   }
 
-  virtual Method::result_type asBoolean(const std::vector<ObjectPtr>& params) {
+  virtual Method::result_type asBoolean(Args params) {
     if (params.size() != 0) {
       throw std::runtime_error("__bool__: Invalid number of arguments");
     }
 
-    return std::make_shared<Boolean>(this->value != 0);
+    return Boolean::of(this->value != 0);
   }
 
-  virtual Method::result_type asString(const std::vector<ObjectPtr>& params) {
+  virtual Method::result_type asString(Args params) {
     if (params.size() != 0) {
       throw std::runtime_error("__str__: Invalid number of arguments");
     }
 
-    return std::make_shared<String>(std::to_string(value));
+    return makeRef<String>(std::to_string(value));
   }
 };
@@ -0,0 +1,201 @@
+// Copyright (c) 2024 Syntax Errors.
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "./NumericKernels.hpp"
+
+namespace {
+    // Integers and reals handled per step by the vector kernels
+#if defined(__AVX2__)
+    constexpr std::size_t intLanes = 8;
+    constexpr std::size_t realLanes = 4;
+    using Ints = __m256i;
+    using Reals = __m256d;
+
+    inline Ints load(const int32_t* data) { return _mm256_loadu_si256(reinterpret_cast<const Ints*>(data)); }
+    inline Ints broadcast(int32_t value) { return _mm256_set1_epi32(value); }
+    inline Ints add(Ints lhs, Ints rhs) { return _mm256_add_epi32(lhs, rhs); }
+    inline Ints lesser(Ints lhs, Ints rhs) { return _mm256_min_epi32(lhs, rhs); }
+    inline Ints larger(Ints lhs, Ints rhs) { return _mm256_max_epi32(lhs, rhs); }
+    inline uint32_t equal(Ints lhs, Ints rhs) {
+        return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(lhs, rhs))));
+    }
+    inline void store(int32_t* data, Ints block) { _mm256_storeu_si256(reinterpret_cast<Ints*>(data), block); }
+
+    inline Reals load(const double* data) { return _mm256_loadu_pd(data); }
+    inline Reals broadcast(double value) { return _mm256_set1_pd(value); }
+    inline Reals add(Reals lhs, Reals rhs) { return _mm256_add_pd(lhs, rhs); }
+    inline Reals lesser(Reals lhs, Reals rhs) { return _mm256_min_pd(lhs, rhs); }
+    inline Reals larger(Reals lhs, Reals rhs) { return _mm256_max_pd(lhs, rhs); }
+    inline uint32_t equal(Reals lhs, Reals rhs) {
+        return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ)));
+    }
+    inline void store(double* data, Reals block) { _mm256_storeu_pd(data, block); }
+#elif defined(__SSE2__)
+    constexpr std::size_t intLanes = 4;
+    constexpr std::size_t realLanes = 2;
+    using Ints = __m128i;
+    using Reals = __m128d;
+
+    inline Ints load(const int32_t* data) { return _mm_loadu_si128(reinterpret_cast<const Ints*>(data)); }
+    inline Ints broadcast(int32_t value) { return _mm_set1_epi32(value); }
+    inline Ints add(Ints lhs, Ints rhs) { return _mm_add_epi32(lhs, rhs); }
+    // SSE2 has no 32-bit min or max, so lanes are picked by a comparison
+    inline Ints lesser(Ints lhs, Ints rhs) {
+        Ints pick = _mm_cmpgt_epi32(lhs, rhs);
+        return _mm_or_si128(_mm_and_si128(pick, rhs), _mm_andnot_si128(pick, lhs));
+    }
+    inline Ints larger(Ints lhs, Ints rhs) {
+        Ints pick = _mm_cmpgt_epi32(rhs, lhs);
+        return _mm_or_si128(_mm_and_si128(pick, rhs), _mm_andnot_si128(pick, lhs));
+    }
+    inline uint32_t equal(Ints lhs, Ints rhs) {
+        return static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(lhs, rhs))));
+    }
+    inline void store(int32_t* data, Ints block) { _mm_storeu_si128(reinterpret_cast<Ints*>(data), block); }
+
+    inline Reals load(const double* data) { return _mm_loadu_pd(data); }
+    inline Reals broadcast(double value) { return _mm_set1_pd(value); }
+    inline Reals add(Reals lhs, Reals rhs) { return _mm_add_pd(lhs, rhs); }
+    inline Reals lesser(Reals lhs, Reals rhs) { return _mm_min_pd(lhs, rhs); }
+    inline Reals larger(Reals lhs, Reals rhs) { return _mm_max_pd(lhs, rhs); }
+    inline uint32_t equal(Reals lhs, Reals rhs) { return static_cast<uint32_t>(_mm_movemask_pd(_mm_cmpeq_pd(lhs, rhs))); }
+    inline void store(double* data, Reals block) { _mm_storeu_pd(data, block); }
+#endif
+
+    // Fold a buffer with `combine`, a block of lanes at a time, then the lanes
+    // in order, then the tail
+    template <typename T, typename Combine, typename CombineBlocks>
+    T fold(const T* data, std::size_t size, Combine combine, CombineBlocks combineBlocks) {
+        std::size_t index = 0;
+        T result;
+#if defined(__AVX2__) || defined(__SSE2__)
+        constexpr std::size_t lanes = std::is_same_v<T, int32_t> ? intLanes : realLanes;
+        if (size >= lanes) {
+            auto block = load(data);
+            for (index = lanes; index + lanes <= size; index += lanes) {
+                block = combineBlocks(block, load(data + index));
+            }
+
+            T values[lanes];
+            store(values, block);
+            result = values[0];
+            for (std::size_t lane = 1; lane < lanes; ++lane) {
+                result = combine(result, values[lane]);
+            }
+        } else {
+            result = data[index++];
+        }
+#else
+        result = data[index++];
+#endif
+        for (; index < size; ++index) {
+            result = combine(result, data[index]);
+        }
+        return result;
+    }
+
+    template <typename T>
+    std::size_t findValue(const T* data, std::size_t size, T value) {
+        std::size_t index = 0;
+#if defined(__AVX2__) || defined(__SSE2__)
+        constexpr std::size_t lanes = std::is_same_v<T, int32_t> ? intLanes : realLanes;
+        const auto needle = broadcast(value);
+        for (; index + lanes <= size; index += lanes) {
+            uint32_t matches = equal(load(data + index), needle);
+            if (matches) {
+                return index + std::countr_zero(matches);
+            }
+        }
+#endif
+        for (; index < size; ++index) {
+            if (data[index] == value) {
+                return index;
+            }
+        }
+        return NumericKernels::npos;
+    }
+}
+
+namespace NumericKernels {
+    int32_t sum(const int32_t* data, std::size_t size) {
+        if (size == 0) {
+            return 0;
+        }
+
+        // Unsigned lanes wrap around the same way without overflowing
+        auto plus = [](int32_t lhs, int32_t rhs) {
+            return static_cast<int32_t>(static_cast<uint32_t>(lhs) + static_cast<uint32_t>(rhs));
+        };
+        return fold(data, size, plus, [](auto lhs, auto rhs) { return add(lhs, rhs); });
+    }
+
+    double sum(const double* data, std::size_t size) {
+        if (size == 0) {
+            return 0;
+        }
+        return fold(data, size, std::plus<double>(), [](auto lhs, auto rhs) { return add(lhs, rhs); });
+    }
+
+    int32_t min(const int32_t* data, std::size_t size) {
+        return fold(data, size,
+            [](int32_t lhs, int32_t rhs) { return std::min(lhs, rhs); },
+            [](auto lhs, auto rhs) { return lesser(lhs, rhs); });
+    }
+
+    int32_t max(const int32_t* data, std::size_t size) {
+        return fold(data, size,
+            [](int32_t lhs, int32_t rhs) { return std::max(lhs, rhs); },
+            [](auto lhs, auto rhs) { return larger(lhs, rhs); });
+    }
+
+    double min(const double* data, std::size_t size) {
+        return fold(data, size,
+            [](double lhs, double rhs) { return std::min(lhs, rhs); },
+            [](auto lhs, auto rhs) { return lesser(lhs, rhs); });
+    }
+
+    double max(const double* data, std::size_t size) {
+        return fold(data, size,
+            [](double lhs, double rhs) { return std::max(lhs, rhs); },
+            [](auto lhs, auto rhs) { return larger(lhs, rhs); });
+    }
+
+    std::size_t find(const int32_t* data, std::size_t size, int32_t value) {
+        return findValue(data, size, value);
+    }
+
+    std::size_t find(const double* data, std::size_t size, double value) {
+        return findValue(data, size, value);
+    }
+
+    bool equal(const int32_t* lhs, const int32_t* rhs, std::size_t size) {
+        return size == 0 || std::memcmp(lhs, rhs, size * sizeof(int32_t)) == 0;
+    }
+
+    bool equal(const double* lhs, const double* rhs, std::size_t size) {
+        // Compared as numbers, so 0.0 equals -0.0 and NaN equals nothing
+        std::size_t index = 0;
+#if defined(__AVX2__) || defined(__SSE2__)
+        constexpr uint32_t allLanes = (1u << realLanes) - 1;
+        for (; index + realLanes <= size; index += realLanes) {
+            if (::equal(load(lhs + index), load(rhs + index)) != allLanes) {
+                return false;
+            }
+        }
+#endif
+        for (; index < size; ++index) {
+            if (lhs[index] != rhs[index]) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
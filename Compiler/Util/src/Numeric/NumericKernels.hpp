@@ -0,0 +1,33 @@
+// Copyright (c) 2024 Syntax Errors.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Reductions and searches over unboxed numbers, behind the List and Tuple
+// methods (see Collections/Sequence.hpp). Kernels use AVX2 or SSE2 when the
+// target has them and plain loops otherwise
+namespace NumericKernels {
+    constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    // Sum wrapping around on overflow, like Integer addition
+    int32_t sum(const int32_t* data, std::size_t size);
+
+    // Sum added across a fixed number of lanes, so the same numbers always
+    // give the same result
+    double sum(const double* data, std::size_t size);
+
+    // Smallest and largest element, `size` must not be zero
+    int32_t min(const int32_t* data, std::size_t size);
+    int32_t max(const int32_t* data, std::size_t size);
+    double min(const double* data, std::size_t size);
+    double max(const double* data, std::size_t size);
+
+    // First position holding `value`, or npos
+    std::size_t find(const int32_t* data, std::size_t size, int32_t value);
+    std::size_t find(const double* data, std::size_t size, double value);
+
+    // Whether both buffers hold equal numbers at every position
+    bool equal(const int32_t* lhs, const int32_t* rhs, std::size_t size);
+    bool equal(const double* lhs, const double* rhs, std::size_t size);
+}
@@ -0,0 +1,56 @@
+// Copyright (c) 2024 Syntax Errors.
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "./methods.hpp"
+
+namespace {
+  // Process-wide registry of method names, seeded with the builtin ones
+  struct MethodRegistry {
+    std::mutex mutex;
+    std::deque<std::string> names;
+    std::unordered_map<std::string, MethodId> ids;
+
+    MethodRegistry() {
+      #define REGISTER_METHOD(ID, NAME) names.push_back(NAME);
+      BUILTIN_METHODS(REGISTER_METHOD)
+      #undef REGISTER_METHOD
+
+      for (MethodId id = 0; id < names.size(); ++id) {
+        ids.emplace(names[id], id);
+      }
+    }
+  };
+
+  MethodRegistry& registry() {
+    static MethodRegistry instance;
+    return instance;
+  }
+}
+
+namespace Methods {
+  MethodId intern(const std::string& name) {
+    MethodRegistry& methods = registry();
+    std::lock_guard<std::mutex> lock(methods.mutex);
+
+    auto [it, inserted] = methods.ids.emplace(name, methods.names.size());
+    if (inserted) {
+      methods.names.push_back(name);
+    }
+
+    return it->second;
+  }
+
+  const std::string& name(MethodId id) {
+    MethodRegistry& methods = registry();
+    std::lock_guard<std::mutex> lock(methods.mutex);
+
+    if (id >= methods.names.size()) {
+      throw std::out_of_range("Unknown method identifier");
+    }
+
+    return methods.names[id];
+  }
+}
@@ -0,0 +1,66 @@
+// Copyright (c) 2024 Syntax Errors.
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// Interned identifier of a method name
+using MethodId = std::size_t;
+
+// Methods known at compile time, by C++ identifier and Python name.
+// Keep in sync with BUILTIN_METHODS in CppGenerator/BuiltInFuctions.py
+#define BUILTIN_METHODS(METHOD) \
+  METHOD(append, "append") \
+  METHOD(extend, "extend") \
+  METHOD(insert, "insert") \
+  METHOD(index, "index") \
+  METHOD(slice, "slice") \
+  METHOD(pop, "pop") \
+  METHOD(clear, "clear") \
+  METHOD(remove, "remove") \
+  METHOD(sort, "sort") \
+  METHOD(add, "add") \
+  METHOD(has, "has") \
+  METHOD(get, "get") \
+  METHOD(keys, "keys") \
+  METHOD(values, "values") \
+  METHOD(items, "items") \
+  METHOD(addElement, "addElement") \
+  METHOD(unionW, "union") \
+  METHOD(intersection, "intersection") \
+  METHOD(difference, "difference") \
+  METHOD(join, "join") \
+  METHOD(split, "split") \
+  METHOD(find, "find") \
+  METHOD(rfind, "rfind") \
+  METHOD(count, "count") \
+  METHOD(replace, "replace") \
+  METHOD(startswith, "startswith") \
+  METHOD(endswith, "endswith") \
+  METHOD(strip, "strip") \
+  METHOD(upper, "upper") \
+  METHOD(lower, "lower") \
+  METHOD(abs, "__abs__") \
+  METHOD(len, "__len__") \
+  METHOD(min, "__min__") \
+  METHOD(max, "__max__") \
+  METHOD(sum, "__sum__") \
+  METHOD(next, "__next__") \
+  METHOD(asBoolean, "__bool__") \
+  METHOD(asString, "__str__")
+
+// Precomputed identifiers, emitted by the generator as Methods::<name>
+namespace Methods {
+  #define DECLARE_METHOD_ID(ID, NAME) ID,
+  enum : MethodId {
+    BUILTIN_METHODS(DECLARE_METHOD_ID)
+    builtinCount
+  };
+  #undef DECLARE_METHOD_ID
+
+  // Get identifier for a method name, registering it if never seen before
+  MethodId intern(const std::string& name);
+
+  // Get method name registered for an identifier
+  const std::string& name(MethodId id);
+}
@@ -1,6 +1,5 @@
 // Copyright (c) 2024 Syntax Errors.
 #include "./object.hpp"
-#include "object.hpp"
 
 
 // Conversion to Object shared pointer 
@@ -19,16 +18,12 @@ std::size_t Object::hash() const {
 }
 
 // Comparison operators
-bool Object::equals(unused const Object& other) const {
+std::partial_ordering Object::compare(unused const Object& other) const {
     throw std::runtime_error("Comparison not supported for this type");
 }
 
-bool Object::less(unused const Object& other) const {
-    throw std::runtime_error("Comparison not supported for this type");
-}
-
-bool Object::greater(unused const Object& other) const {
-    throw std::runtime_error("Comparison not supported for this type");
+bool Object::equals(const Object& other) const {
+    return compare(other) == 0;
 }
 
 // Arithmetic operations
@@ -52,6 +47,10 @@ ObjectPtr Object::subscript(unused const Object& other) const {
     throw std::runtime_error("Subscript not supported for this type");
 }
 
+var* Object::slot(unused const Object& other) {
+    return nullptr;
+}
+
 // Shift operations
 ObjectPtr Object::shiftLeft(unused const Object& other) const {
     throw std::runtime_error("Shift left not supported for this type");
@@ -63,20 +62,47 @@ ObjectPtr Object::shiftRight(unused const Object& other) const {
 
 // Check type equivalence
 bool Object::isSameType(const Object& other) const {
-return typeid(*this) == typeid(other);
+    return _type == other._type;
+}
+
+const char* typeName(TypeTag type) {
+    switch (type) {
+        case TypeTag::Integer: return "Integer";
+        case TypeTag::Double: return "Double";
+        case TypeTag::Boolean: return "Boolean";
+        case TypeTag::String: return "String";
+        case TypeTag::List: return "List";
+        case TypeTag::Tuple: return "Tuple";
+        case TypeTag::Set: return "Set";
+        case TypeTag::Map: return "Map";
+        case TypeTag::MapView: return "MapView";
+        case TypeTag::Pair: return "Pair";
+        case TypeTag::Iterator: return "Iterator";
+        default: return "Object";
+    }
 }
 
-// ------------------ Per-instance methods ------------------
+// ------------------ Per-class methods ------------------
+
+// Objects support no methods unless their class registers some
+const MethodTable& Object::getMethods() const {
+    static const MethodTable methods;
+    return methods;
+}
 
 // Call method supported by object instance
-Object::Method::result_type Object::Call(const std::string& name, std::initializer_list<ObjectPtr> params) {
-    auto matchedMethod = _methods.find(name);
+Object::Method::result_type Object::Call(MethodId id, Args params) {
+    auto matchedMethod = getMethods().find(id);
 
-    if (matchedMethod == _methods.end()) {
-        throw std::runtime_error("Object has no method " + name);
+    if (!matchedMethod) {
+        throw std::runtime_error("Object has no method " + Methods::name(id));
     }
 
-    return matchedMethod->second(params);
+    return (this->*matchedMethod->method)(params);
+}
+
+Object::Method::result_type Object::Call(const std::string& name, Args params) {
+    return Call(Methods::intern(name), params);
 }
 
 // ------------------ Iterator ------------------
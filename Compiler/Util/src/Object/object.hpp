@@ -1,104 +1,359 @@
-// Copyright (c) 2024 Syntax Errors.
-#pragma once
-
-#include <compare>
-#include <iostream>
-#include <iterator>
-#include <memory>
-#include <string>
-#include <utility>
-
-#include <functional>
-#include <map>
-#include <type_traits>
-
-#define implicit
-#define unused [[maybe_unused]]
-
-// Forward-declarations
-class Object;
-using ObjectPtr = std::shared_ptr<Object>;
-
-class Object {
- protected:
-  // Callable methods by name and parameters
-  using Method = std::function<ObjectPtr(const std::vector<ObjectPtr>&)>;
-  std::map<std::string, Method> _methods;
-
- public:
-  virtual ~Object() = default;
-
-  // ------------------ Native operators ------------------
-  
-  virtual operator ObjectPtr();
-
-  // Conversion operator to bool (can be customized based on logic)
-  virtual explicit operator bool() const;
-
-  // Conversion to hash (for associative containers)
-  virtual std::size_t hash() const;
-
-  // Comparison operators
-  virtual bool equals(unused const Object& other) const;
-
-  virtual bool less(unused const Object& other) const;
-
-  virtual bool greater(unused const Object& other) const;
-
-  // Arithmetic operations
-  virtual ObjectPtr add(unused const Object& other) const;
-
-  virtual ObjectPtr subtract(unused const Object& other) const;
-
-  virtual ObjectPtr multiply(unused const Object& other) const;
-
-  virtual ObjectPtr divide(unused const Object& other) const;
-
-  virtual ObjectPtr subscript(unused const Object& other) const;
-
-  // Shift operations
-  virtual ObjectPtr shiftLeft(unused const Object& other) const;
-
-  virtual ObjectPtr shiftRight(unused const Object& other) const;
-
-  // ------------------ Native methods ------------------
-
-  // Print contents
-  virtual void print(std::ostream& os) const = 0;
-  
-  // Clone itself
-  virtual ObjectPtr clone() const = 0;
-
-  // Check type equivalence
-  virtual bool isSameType(const Object& other) const;
-
-  // ------------------ Per-instance methods ------------------
-
-  // Call method supported by object instance
-  Method::result_type Call(const std::string& name, std::initializer_list<ObjectPtr> params);
-
-  // ------------------ Iterator ------------------
-
-  class ObjectIterator;
-  using ObjectIt = std::shared_ptr<Object::ObjectIterator>;
-
-  // Default iteration behavior
-  class ObjectIterator {
-   public:
-    virtual ~ObjectIterator() = default;
-
-    virtual bool hasNext() const = 0;
-    virtual ObjectPtr next() = 0;
-    virtual ObjectIt clone() const = 0;
-  };
-
-  virtual ObjectIt getIterator() const;
-};
-
-// Hashing for associative containers
-namespace std {
-  template<> struct hash<Object> {
-    size_t operator()(const Object& s) const noexcept
-    { return s.hash();}
-  };
-}
+// Copyright (c) 2024 Syntax Errors.
+#pragma once
+
+#include <compare>
+#include <cstdint>
+#include <iostream>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include "./methods.hpp"
+#include "./pool.hpp"
+#include "./ref.hpp"
+
+#define implicit
+#define unused [[maybe_unused]]
+
+// Forward-declarations
+class Object;
+class MethodTable;
+class var;
+using ObjectPtr = Ref<Object>;
+
+// Arguments of a method or builtin call, borrowed from the caller for the
+// duration of the call. Braced argument lists live on the caller's stack
+// until the call returns, so Args is only ever a parameter: never keep one
+// built from a braced list (`Args args = {x};` dangles)
+class Args {
+ private:
+  const ObjectPtr* _data;
+  std::size_t _size;
+
+ public:
+  constexpr Args() noexcept : _data(nullptr), _size(0) {}
+
+  // The array behind a braced argument list outlives the call it is passed
+  // to, which is all Args borrows it for. Named lists are refused
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winit-list-lifetime"
+#endif
+  constexpr Args(std::initializer_list<ObjectPtr>&& params) noexcept
+    : _data(params.begin()), _size(params.size()) {}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+  Args(const std::initializer_list<ObjectPtr>& params) = delete;
+
+  Args(const std::vector<ObjectPtr>& params) noexcept
+    : _data(params.data()), _size(params.size()) {}
+
+  constexpr Args(const ObjectPtr* data, std::size_t size) noexcept : _data(data), _size(size) {}
+
+  inline std::size_t size() const noexcept { return _size; }
+
+  inline bool empty() const noexcept { return _size == 0; }
+
+  inline const ObjectPtr& operator[](std::size_t index) const noexcept { return _data[index]; }
+
+  inline const ObjectPtr* begin() const noexcept { return _data; }
+
+  inline const ObjectPtr* end() const noexcept { return _data + _size; }
+};
+
+// Concrete type of a runtime object, used instead of RTTI
+enum class TypeTag : uint8_t {
+  Object,
+  Integer,
+  Double,
+  Boolean,
+  String,
+  List,
+  Tuple,
+  Set,
+  Map,
+  MapView,
+  Pair,
+  Iterator
+};
+
+// Readable name of a type tag
+const char* typeName(TypeTag type);
+
+// Hash of an immutable object, computed on first use and kept. Zero marks an
+// unknown hash, so a computed zero is stored as one
+class HashCache {
+ private:
+#ifdef ATOMIC_REFCOUNT
+  mutable std::atomic<std::size_t> _hash{0};
+#else
+  mutable std::size_t _hash = 0;
+#endif
+
+ public:
+  HashCache() = default;
+
+  // Equal values have equal hashes, copies may keep it
+  HashCache(const HashCache& other) noexcept : _hash(other.load()) {}
+  HashCache& operator=(const HashCache& other) noexcept {
+    store(other.load());
+    return *this;
+  }
+
+  template <typename Compute>
+  inline std::size_t get(Compute compute) const {
+    std::size_t hash = load();
+    if (hash == 0) {
+      hash = compute();
+      hash = hash == 0 ? 1 : hash;
+      store(hash);
+    }
+    return hash;
+  }
+
+  // Forget the hash of a value that was rebuilt in place
+  inline void reset() noexcept { store(0); }
+
+ private:
+  inline std::size_t load() const noexcept {
+#ifdef ATOMIC_REFCOUNT
+    return _hash.load(std::memory_order_relaxed);
+#else
+    return _hash;
+#endif
+  }
+
+  inline void store(std::size_t hash) const noexcept {
+#ifdef ATOMIC_REFCOUNT
+    _hash.store(hash, std::memory_order_relaxed);
+#else
+    _hash = hash;
+#endif
+  }
+};
+
+// Loops walking an object in place, which hold it without sharing it with
+// anyone (see Collections/Cursor.hpp). A copied object starts with none
+class LoopCount {
+ private:
+  uint16_t _count = 0;
+
+ public:
+  LoopCount() = default;
+  LoopCount(const LoopCount&) noexcept {}
+  LoopCount& operator=(const LoopCount&) noexcept { return *this; }
+
+  inline void increment() noexcept { ++_count; }
+  inline void decrement() noexcept { --_count; }
+  inline uint16_t load() const noexcept { return _count; }
+};
+
+class Object {
+  friend class MethodTable;
+  template <typename T> friend class Ref;
+
+ private:
+  // Concrete type of this instance
+  TypeTag _type;
+
+  // Loops walking this instance, kept in the padding before the count
+  mutable LoopCount _loops;
+
+  // Owners of this instance, managed by Ref
+  mutable RefCount _refs;
+
+  inline RefCount& refCount() const { return _refs; }
+
+ protected:
+  // Turn into a shared constant that is never freed (see Integer::of)
+  inline void makeImmortal() { _refs.makeImmortal(); }
+
+ protected:
+  // Callable methods signature
+  using Method = std::function<ObjectPtr(Args)>;
+
+ public:
+  static constexpr TypeTag tag = TypeTag::Object;
+
+  explicit Object(TypeTag type = tag) : _type(type) {}
+  virtual ~Object() = default;
+
+  // Instances are allocated from the runtime pools
+  static void* operator new(std::size_t size) { return Pool::allocate(size); }
+  static void operator delete(void* ptr, std::size_t size) noexcept { Pool::deallocate(ptr, size); }
+
+  // Concrete type of this instance
+  inline TypeTag type() const { return _type; }
+
+  // Loops walking this instance, counted among its owners by Ref
+  inline uint16_t loops() const { return _loops.load(); }
+  inline void enterLoop() const { _loops.increment(); }
+  inline void leaveLoop() const { _loops.decrement(); }
+
+  // ------------------ Native operators ------------------
+  
+  virtual operator ObjectPtr();
+
+  // Conversion operator to bool (can be customized based on logic)
+  virtual explicit operator bool() const;
+
+  // Conversion to hash (for associative containers)
+  virtual std::size_t hash() const;
+
+  // Three-way comparison, unordered when the two cannot be ordered
+  virtual std::partial_ordering compare(unused const Object& other) const;
+
+  // Comparison operators, from compare() unless equality is cheaper to
+  // tell (or defined without an order, as for sets)
+  virtual bool equals(const Object& other) const;
+
+  inline bool less(const Object& other) const { return compare(other) < 0; }
+
+  inline bool greater(const Object& other) const { return compare(other) > 0; }
+
+  // Arithmetic operations
+  virtual ObjectPtr add(unused const Object& other) const;
+
+  virtual ObjectPtr subtract(unused const Object& other) const;
+
+  virtual ObjectPtr multiply(unused const Object& other) const;
+
+  virtual ObjectPtr divide(unused const Object& other) const;
+
+  virtual ObjectPtr subscript(unused const Object& other) const;
+
+  // Stored element for a subscript, to be changed in place right away (see
+  // var::Element), or null when elements cannot be reached that way
+  virtual var* slot(unused const Object& other);
+
+  // Shift operations
+  virtual ObjectPtr shiftLeft(unused const Object& other) const;
+
+  virtual ObjectPtr shiftRight(unused const Object& other) const;
+
+  // ------------------ Native methods ------------------
+
+  // Print contents
+  virtual void print(std::ostream& os) const = 0;
+  
+  // Clone itself
+  virtual ObjectPtr clone() const = 0;
+
+  // Check type equivalence
+  virtual bool isSameType(const Object& other) const;
+
+  // ------------------ Per-class methods ------------------
+
+  // Methods supported by the class of this instance
+  virtual const MethodTable& getMethods() const;
+
+  // Call method supported by object instance
+  Method::result_type Call(MethodId id, Args params);
+  Method::result_type Call(const std::string& name, Args params);
+
+  // ------------------ Iterator ------------------
+
+  class ObjectIterator;
+  using ObjectIt = std::shared_ptr<Object::ObjectIterator>;
+
+  // Default iteration behavior
+  class ObjectIterator {
+   public:
+    virtual ~ObjectIterator() = default;
+
+    virtual bool hasNext() const = 0;
+    virtual ObjectPtr next() = 0;
+    virtual ObjectIt clone() const = 0;
+  };
+
+  virtual ObjectIt getIterator() const;
+};
+
+// Allocate an object iterator from the runtime pools
+template <typename T, typename... Args>
+inline Object::ObjectIt makeIterator(Args&&... args) {
+  return std::allocate_shared<T>(Pool::Allocator<T>(), std::forward<Args>(args)...);
+}
+
+// Checked downcasts by type tag
+template <typename T>
+inline const T* objectCast(const Object* obj) {
+  return (obj && obj->type() == T::tag) ? static_cast<const T*>(obj) : nullptr;
+}
+
+template <typename T>
+inline T* objectCast(Object* obj) {
+  return (obj && obj->type() == T::tag) ? static_cast<T*>(obj) : nullptr;
+}
+
+template <typename T>
+inline Ref<T> objectCast(const ObjectPtr& obj) {
+  return (obj && obj->type() == T::tag) ? Ref<T>(static_cast<T*>(obj.get())) : nullptr;
+}
+
+// Immutable dispatch table shared by every instance of a class
+class MethodTable {
+ public:
+  // Method implemented by a class, invoked on an instance of it
+  using NativeMethod = Object::Method::result_type (Object::*)(Args);
+
+  struct Entry {
+    NativeMethod method = nullptr;
+    // Whether the method modifies its instance (triggers copy-on-write)
+    bool mutates = false;
+  };
+
+ private:
+  // Entries indexed by method identifier
+  std::vector<Entry> _entries;
+
+ public:
+  MethodTable() = default;
+
+  // Register a method of a derived class
+  template <typename Derived>
+  MethodTable& add(
+      MethodId id,
+      Object::Method::result_type (Derived::*method)(Args),
+      bool mutates = false) {
+    static_assert(std::is_base_of_v<Object, Derived>, "Methods must belong to an Object");
+
+    if (id >= _entries.size()) {
+      _entries.resize(id + 1);
+    }
+
+    _entries[id] = Entry{static_cast<NativeMethod>(method), mutates};
+    return *this;
+  }
+
+  // Unregister a method inherited from a base class
+  MethodTable& erase(MethodId id) {
+    if (id < _entries.size()) {
+      _entries[id] = Entry{};
+    }
+    return *this;
+  }
+
+  // Get method registered for identifier, if any
+  inline const Entry* find(MethodId id) const {
+    if (id >= _entries.size() || !_entries[id].method) {
+      return nullptr;
+    }
+    return &_entries[id];
+  }
+};
+
+// Hashing for associative containers
+namespace std {
+  template<> struct hash<Object> {
+    size_t operator()(const Object& s) const noexcept
+    { return s.hash();}
+  };
+}
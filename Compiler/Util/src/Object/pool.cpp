@@ -0,0 +1,229 @@
+// Copyright (c) 2024 Syntax Errors.
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "./pool.hpp"
+
+namespace {
+  constexpr std::size_t granularity = 16;
+  constexpr std::size_t classCount = Pool::maxBlockSize / granularity;
+  constexpr std::size_t slabSize = 64 * 1024;
+
+  // Freed blocks are linked through their own storage
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  inline std::size_t sizeClass(std::size_t size) {
+    return (std::max<std::size_t>(size, 1) - 1) / granularity;
+  }
+
+  inline std::size_t blockSize(std::size_t classIndex) {
+    return (classIndex + 1) * granularity;
+  }
+
+  // Push a chain of blocks onto a free list
+  inline void splice(FreeBlock*& list, FreeBlock* head) {
+    if (!head) {
+      return;
+    }
+
+    FreeBlock* tail = head;
+    while (tail->next) {
+      tail = tail->next;
+    }
+    tail->next = list;
+    list = head;
+  }
+
+  struct ThreadCache;
+
+  // Slabs and state shared by all threads. Blocks of exited threads are
+  // parked here until another thread needs them
+  struct Depot {
+    std::mutex mutex;
+    std::size_t slabCount = 0;
+    FreeBlock* freeLists[classCount] = {};
+    std::vector<ThreadCache*> caches;
+    // Balance of the in-use counters of exited threads
+    std::ptrdiff_t retiredBytes = 0;
+
+    // Carve a new slab into blocks of a size class, returns the chain
+    FreeBlock* reserveSlab(std::size_t classIndex) {
+      char* slab = static_cast<char*>(::operator new(slabSize));
+      const std::size_t size = blockSize(classIndex);
+      const std::size_t count = slabSize / size;
+
+      for (std::size_t index = 0; index + 1 < count; ++index) {
+        reinterpret_cast<FreeBlock*>(slab + index * size)->next =
+          reinterpret_cast<FreeBlock*>(slab + (index + 1) * size);
+      }
+      reinterpret_cast<FreeBlock*>(slab + (count - 1) * size)->next = nullptr;
+
+      ++slabCount;
+      return reinterpret_cast<FreeBlock*>(slab);
+    }
+
+    // Hand out every parked block of a size class, or a fresh slab
+    FreeBlock* take(std::size_t classIndex) {
+      FreeBlock* chain = std::exchange(freeLists[classIndex], nullptr);
+      return chain ? chain : reserveSlab(classIndex);
+    }
+  };
+
+  // Never destroyed, blocks may be freed during static destruction
+  Depot& depot() {
+    static Depot* instance = new Depot();
+    return *instance;
+  }
+
+  struct ThreadCache {
+    FreeBlock* freeLists[classCount] = {};
+    // Only written by the owning thread, read by Pool::stats
+    std::atomic<std::ptrdiff_t> bytesInUse{0};
+
+    ThreadCache() {
+      Depot& shared = depot();
+      std::lock_guard<std::mutex> lock(shared.mutex);
+      shared.caches.push_back(this);
+    }
+
+    ~ThreadCache() {
+      Depot& shared = depot();
+      std::lock_guard<std::mutex> lock(shared.mutex);
+
+      for (std::size_t index = 0; index < classCount; ++index) {
+        splice(shared.freeLists[index], freeLists[index]);
+      }
+      shared.retiredBytes += bytesInUse.load(std::memory_order_relaxed);
+      shared.caches.erase(std::find(shared.caches.begin(), shared.caches.end(), this));
+    }
+
+    inline void account(std::ptrdiff_t bytes) {
+      bytesInUse.store(bytesInUse.load(std::memory_order_relaxed) + bytes, std::memory_order_relaxed);
+    }
+  };
+
+  thread_local ThreadCache* localCache = nullptr;
+  thread_local bool localCacheDestroyed = false;
+
+  // Owns the cache of the current thread, created on first use
+  struct CacheOwner {
+    ThreadCache cache;
+
+    CacheOwner() { localCache = &cache; }
+
+    ~CacheOwner() {
+      localCache = nullptr;
+      localCacheDestroyed = true;
+    }
+  };
+
+  // Null once the thread is tearing down its thread-local storage
+  inline ThreadCache* currentCache() {
+    if (localCache || localCacheDestroyed) {
+      return localCache;
+    }
+
+    thread_local CacheOwner owner;
+    return localCache;
+  }
+}
+
+namespace Pool {
+  void* allocate(std::size_t size) {
+    ThreadCache* cache = currentCache();
+
+    if (size > maxBlockSize) {
+      if (cache) {
+        cache->account(size);
+      } else {
+        Depot& shared = depot();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        shared.retiredBytes += size;
+      }
+      return ::operator new(size);
+    }
+
+    const std::size_t index = sizeClass(size);
+    const std::size_t bytes = blockSize(index);
+    FreeBlock* block;
+
+    if (cache) {
+      if (!cache->freeLists[index]) {
+        Depot& shared = depot();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        cache->freeLists[index] = shared.take(index);
+      }
+
+      block = cache->freeLists[index];
+      cache->freeLists[index] = block->next;
+      cache->account(bytes);
+    } else {
+      Depot& shared = depot();
+      std::lock_guard<std::mutex> lock(shared.mutex);
+      if (!shared.freeLists[index]) {
+        shared.freeLists[index] = shared.reserveSlab(index);
+      }
+
+      block = shared.freeLists[index];
+      shared.freeLists[index] = block->next;
+      shared.retiredBytes += bytes;
+    }
+
+    return block;
+  }
+
+  void deallocate(void* ptr, std::size_t size) noexcept {
+    if (!ptr) {
+      return;
+    }
+
+    ThreadCache* cache = currentCache();
+    const bool pooled = size <= maxBlockSize;
+    const std::size_t index = sizeClass(size);
+    const std::size_t bytes = pooled ? blockSize(index) : size;
+
+    if (cache) {
+      cache->account(-static_cast<std::ptrdiff_t>(bytes));
+      if (pooled) {
+        FreeBlock* block = static_cast<FreeBlock*>(ptr);
+        block->next = cache->freeLists[index];
+        cache->freeLists[index] = block;
+      }
+    } else {
+      Depot& shared = depot();
+      std::lock_guard<std::mutex> lock(shared.mutex);
+      shared.retiredBytes -= bytes;
+      if (pooled) {
+        FreeBlock* block = static_cast<FreeBlock*>(ptr);
+        block->next = shared.freeLists[index];
+        shared.freeLists[index] = block;
+      }
+    }
+
+    if (!pooled) {
+      ::operator delete(ptr);
+    }
+  }
+
+  Stats stats() {
+    Depot& shared = depot();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+
+    std::ptrdiff_t inUse = shared.retiredBytes;
+    for (const ThreadCache* cache : shared.caches) {
+      inUse += cache->bytesInUse.load(std::memory_order_relaxed);
+    }
+
+    return Stats{
+      static_cast<std::size_t>(std::max<std::ptrdiff_t>(inUse, 0)),
+      shared.slabCount,
+      shared.slabCount * slabSize
+    };
+  }
+}
@@ -0,0 +1,50 @@
+// Copyright (c) 2024 Syntax Errors.
+#pragma once
+
+#include <cstddef>
+
+// Size-class slab allocator for runtime objects and container nodes.
+// Blocks up to maxBlockSize bytes are carved from slabs and recycled through
+// thread-local free lists, larger requests go to the global allocator
+namespace Pool {
+  // Largest request served from slabs, in bytes
+  constexpr std::size_t maxBlockSize = 256;
+
+  struct Stats {
+    // Bytes currently handed out, pooled or not
+    std::size_t bytesInUse;
+    // Slabs reserved so far, slabs are never returned to the system
+    std::size_t slabCount;
+    // Bytes reserved by those slabs
+    std::size_t slabBytes;
+  };
+
+  void* allocate(std::size_t size);
+
+  // `size` must be the same value passed to allocate
+  void deallocate(void* ptr, std::size_t size) noexcept;
+
+  Stats stats();
+
+  // Standard allocator drawing from the pools, for node-based containers
+  template <typename T>
+  struct Allocator {
+    using value_type = T;
+
+    Allocator() noexcept = default;
+
+    template <typename U>
+    Allocator(const Allocator<U>&) noexcept {}
+
+    T* allocate(std::size_t count) {
+      return static_cast<T*>(Pool::allocate(count * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, std::size_t count) noexcept {
+      Pool::deallocate(ptr, count * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const Allocator<U>&) const noexcept { return true; }
+  };
+}  // namespace Pool
@@ -0,0 +1,149 @@
+// Copyright (c) 2024 Syntax Errors.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include <limits>
+
+#ifdef ATOMIC_REFCOUNT
+#include <atomic>
+#endif
+
+// Reference count embedded in every runtime object. Transpiled programs are
+// single-threaded, so it is a plain integer unless built with ATOMIC_REFCOUNT
+class RefCount {
+ private:
+  // Count of shared constants, which are never incremented nor freed
+  static constexpr uint32_t immortal = std::numeric_limits<uint32_t>::max();
+
+#ifdef ATOMIC_REFCOUNT
+  std::atomic<uint32_t> _count{0};
+#else
+  uint32_t _count = 0;
+#endif
+
+ public:
+  RefCount() = default;
+
+  // A copied object starts with no owners of its own
+  RefCount(const RefCount&) noexcept {}
+  RefCount& operator=(const RefCount&) noexcept { return *this; }
+
+  inline void increment() noexcept {
+    if (load() == immortal) {
+      return;
+    }
+#ifdef ATOMIC_REFCOUNT
+    _count.fetch_add(1, std::memory_order_relaxed);
+#else
+    ++_count;
+#endif
+  }
+
+  // Whether the last owner went away
+  inline bool decrement() noexcept {
+    if (load() == immortal) {
+      return false;
+    }
+#ifdef ATOMIC_REFCOUNT
+    return _count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+#else
+    return --_count == 0;
+#endif
+  }
+
+  // Stop counting, the object lives until the program exits
+  inline void makeImmortal() noexcept {
+#ifdef ATOMIC_REFCOUNT
+    _count.store(immortal, std::memory_order_relaxed);
+#else
+    _count = immortal;
+#endif
+  }
+
+  inline uint32_t load() const noexcept {
+#ifdef ATOMIC_REFCOUNT
+    return _count.load(std::memory_order_relaxed);
+#else
+    return _count;
+#endif
+  }
+};
+
+// Owning pointer to an object with an embedded RefCount (see Object)
+template <typename T>
+class Ref {
+  template <typename U> friend class Ref;
+
+ private:
+  T* _ptr = nullptr;
+
+  inline void retain() const noexcept {
+    if (_ptr) {
+      _ptr->refCount().increment();
+    }
+  }
+
+ public:
+  using element_type = T;
+
+  constexpr Ref() noexcept = default;
+
+  constexpr Ref(std::nullptr_t) noexcept {}
+
+  // Take shared ownership of an object, fresh or already owned elsewhere
+  explicit Ref(T* ptr) noexcept : _ptr(ptr) { retain(); }
+
+  Ref(const Ref& other) noexcept : _ptr(other._ptr) { retain(); }
+
+  Ref(Ref&& other) noexcept : _ptr(std::exchange(other._ptr, nullptr)) {}
+
+  // Upcasts
+  template <typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+  Ref(const Ref<U>& other) noexcept : _ptr(other._ptr) { retain(); }
+
+  template <typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+  Ref(Ref<U>&& other) noexcept : _ptr(std::exchange(other._ptr, nullptr)) {}
+
+  ~Ref() { reset(); }
+
+  Ref& operator=(Ref other) noexcept {
+    swap(other);
+    return *this;
+  }
+
+  inline void reset() noexcept {
+    if (_ptr && _ptr->refCount().decrement()) {
+      delete _ptr;
+    }
+    _ptr = nullptr;
+  }
+
+  inline void swap(Ref& other) noexcept { std::swap(_ptr, other._ptr); }
+
+  inline T* get() const noexcept { return _ptr; }
+
+  inline T& operator*() const noexcept { return *_ptr; }
+
+  inline T* operator->() const noexcept { return _ptr; }
+
+  inline explicit operator bool() const noexcept { return _ptr != nullptr; }
+
+  // Number of owners of the pointee, 0 when empty
+  inline long use_count() const noexcept {
+    return _ptr ? static_cast<long>(_ptr->refCount().load()) : 0;
+  }
+
+  friend bool operator==(const Ref& lhs, const Ref& rhs) noexcept { return lhs._ptr == rhs._ptr; }
+
+  friend bool operator==(const Ref& lhs, std::nullptr_t) noexcept { return lhs._ptr == nullptr; }
+};
+
+// Allocate an object owned by the returned Ref, replacement for std::make_shared
+template <typename T, typename... Args>
+inline Ref<T> makeRef(Args&&... args) {
+  return Ref<T>(new T(std::forward<Args>(args)...));
+}
@@ -0,0 +1,197 @@
+// Copyright (c) 2024 Syntax Errors.
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "./tasks.hpp"
+
+namespace {
+  constexpr std::size_t defaultCutoff = 1 << 18;
+
+  // Positive number held by an environment variable, or `fallback`
+  std::size_t fromEnvironment(const char* name, std::size_t fallback) {
+    const char* text = std::getenv(name);
+    if (!text) {
+      return fallback;
+    }
+
+    char* end = nullptr;
+    unsigned long long value = std::strtoull(text, &end, 10);
+    return (end != text && *end == '\0' && value > 0) ? static_cast<std::size_t>(value) : fallback;
+  }
+
+  // One parallelFor call, alive on the caller's stack until all its tasks ran
+  struct Job {
+    const std::function<void(std::size_t)>* task;
+    std::atomic<std::size_t> unfinished;
+  };
+
+  struct Task {
+    Job* job;
+    std::size_t index;
+  };
+
+  // Deque of one thread. Its owner works from the back, thieves from the front
+  class WorkQueue {
+   private:
+    std::mutex mutex;
+    std::deque<Task> tasks;
+
+   public:
+    void push(const Task& task) {
+      std::lock_guard<std::mutex> lock(mutex);
+      tasks.push_back(task);
+    }
+
+    bool pop(Task& task) {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (tasks.empty()) {
+        return false;
+      }
+      task = tasks.back();
+      tasks.pop_back();
+      return true;
+    }
+
+    bool steal(Task& task) {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (tasks.empty()) {
+        return false;
+      }
+      task = tasks.front();
+      tasks.pop_front();
+      return true;
+    }
+  };
+
+  // Set while a task runs, so parallel work started inside it stays serial
+  thread_local bool insideTask = false;
+
+  class ThreadPool {
+   private:
+    // One deque per thread, the first one belongs to the thread calling parallelFor
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    std::vector<std::thread> workers;
+
+    // Sleeping workers wait here until tasks are queued
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    std::atomic<std::ptrdiff_t> queued{0};
+    bool stopping = false;
+
+    // Take a task from deque `own`, or steal one from another deque
+    bool take(std::size_t own, Task& task) {
+      if (queues[own]->pop(task)) {
+        --queued;
+        return true;
+      }
+      for (std::size_t step = 1; step < queues.size(); ++step) {
+        if (queues[(own + step) % queues.size()]->steal(task)) {
+          --queued;
+          return true;
+        }
+      }
+      return false;
+    }
+
+    static void run(const Task& task) {
+      insideTask = true;
+      (*task.job->task)(task.index);
+      insideTask = false;
+      task.job->unfinished.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    void work(std::size_t own) {
+      Task task;
+      while (true) {
+        if (take(own, task)) {
+          run(task);
+          continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        wakeup.wait(lock, [this] { return stopping || queued.load() > 0; });
+        if (stopping) {
+          return;
+        }
+      }
+    }
+
+   public:
+    explicit ThreadPool(std::size_t threads) {
+      for (std::size_t index = 0; index < threads; ++index) {
+        queues.push_back(std::make_unique<WorkQueue>());
+      }
+      for (std::size_t own = 1; own < threads; ++own) {
+        workers.emplace_back(&ThreadPool::work, this, own);
+      }
+    }
+
+    ~ThreadPool() {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+      }
+      wakeup.notify_all();
+      for (std::thread& worker : workers) {
+        worker.join();
+      }
+    }
+
+    void parallelFor(std::size_t count, const std::function<void(std::size_t)>& task) {
+      Job job{&task, {count}};
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        queued += static_cast<std::ptrdiff_t>(count);
+      }
+      // Dealt round-robin, stealing evens out the rest
+      for (std::size_t index = 0; index < count; ++index) {
+        queues[index % queues.size()]->push(Task{&job, index});
+      }
+      wakeup.notify_all();
+
+      Task next;
+      while (job.unfinished.load(std::memory_order_acquire) > 0) {
+        if (take(0, next)) {
+          run(next);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    }
+  };
+
+  ThreadPool& pool() {
+    static ThreadPool instance(Tasks::settings().threads);
+    return instance;
+  }
+}
+
+namespace Tasks {
+  const Settings& settings() {
+    static const Settings current = [] {
+      const std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+      return Settings{
+        fromEnvironment("SE_THREADS", hardware),
+        fromEnvironment("SE_PARALLEL_CUTOFF", defaultCutoff),
+      };
+    }();
+    return current;
+  }
+
+  void parallelFor(std::size_t count, const std::function<void(std::size_t)>& task) {
+    if (count <= 1 || insideTask || settings().threads <= 1) {
+      for (std::size_t index = 0; index < count; ++index) {
+        task(index);
+      }
+      return;
+    }
+    pool().parallelFor(count, task);
+  }
+}  // namespace Tasks
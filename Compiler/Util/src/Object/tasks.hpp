@@ -0,0 +1,35 @@
+// Copyright (c) 2024 Syntax Errors.
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+// Shared thread pool for data-parallel kernels over large collections.
+// Every thread keeps a deque of tasks, popping its own from the back and
+// stealing from the front of the others' when it runs out.
+// Reference counts are not atomic (see ref.hpp), so tasks may only touch
+// plain buffers, never runtime objects
+namespace Tasks {
+  struct Settings {
+    // Threads running tasks, the calling one included, from SE_THREADS.
+    // Defaults to the hardware concurrency, 1 keeps everything serial
+    std::size_t threads;
+    // Elements a collection needs before work on it is split, from
+    // SE_PARALLEL_CUTOFF
+    std::size_t cutoff;
+  };
+
+  // Read from the environment on first use
+  const Settings& settings();
+
+  // Whether work over `size` elements is worth splitting
+  inline bool worthSplitting(std::size_t size) {
+    const Settings& current = settings();
+    return current.threads > 1 && size >= current.cutoff;
+  }
+
+  // Run `task(index)` for every index below `count` across the pool and wait
+  // for all of them. The calling thread takes part, and a task started from
+  // inside another runs serially. Tasks must not throw
+  void parallelFor(std::size_t count, const std::function<void(std::size_t)>& task);
+}  // namespace Tasks
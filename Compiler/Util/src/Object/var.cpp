@@ -5,155 +5,349 @@
 #include "../Numeric/Integer.hpp"
 #include "../Primitive/Boolean.hpp"
 #include "../Primitive/String.hpp"
+#include "../Collections/Cursor.hpp"
 
 // ------------------ var ------------------
-var::var() : value(nullptr) {}
+var::var() : kind(Kind::None), scalar{}, value(nullptr) {}
 
 // Specialized constructors for base types
-var::var(int32_t value) : value(std::make_shared<Integer>(value)) {  }
-var::var(double value) : value(std::make_shared<Double>(value)) {  }
-var::var(const std::string& value) : value(std::make_shared<String>(value)) {  }
-var::var(const char* value) : value(std::make_shared<String>(std::string(value))) {  }
-var::var(bool value) : value(std::make_shared<Boolean>(value)) {  }
+var::var(int32_t value) : kind(Kind::Integer), value(nullptr) { scalar.integer = value; }
+var::var(double value) : kind(Kind::Double), value(nullptr) { scalar.real = value; }
+var::var(const std::string& value) : kind(Kind::Object), scalar{}, value(makeRef<String>(value)) {  }
+var::var(const char* value) : kind(Kind::Object), scalar{}, value(makeRef<String>(std::string(value))) {  }
+var::var(bool value) : kind(Kind::Boolean), value(nullptr) { scalar.boolean = value; }
 
-// Copy constructor and assignment
-var::var(const var& other) : value(other.value ? other.value->clone() : nullptr) { }
+// Copy constructor and assignment, sharing the object until either side mutates it
+var::var(const var& other) : kind(other.kind), scalar(other.scalar), value(other.value) { }
 
 var& var::operator=(const var& other) {
     if (this != &other) {
-        value = other.value ? other.value->clone() : nullptr;
+        *this = var(other);
     }
     return *this;
 }
 
 // Move constructor and assignment
-var::var(var&& other) noexcept : value(std::move(other.value)) {  }
+var::var(var&& other) noexcept
+    : kind(other.kind), scalar(other.scalar), value(std::move(other.value)) {
+    other.kind = Kind::None;
+}
 
-// Copy-assignment from ObjPtr
-var::var(const ObjectPtr& obj) : value(obj) {  }
+var& var::operator=(var&& other) noexcept {
+    if (this != &other) {
+        kind = other.kind;
+        scalar = other.scalar;
+        value = std::move(other.value);
+        other.kind = Kind::None;
+    }
+    return *this;
+}
+
+// Copy-assignment from ObjPtr, unwrapping scalars so they stay inline
+var::var(const ObjectPtr& obj) : kind(Kind::Object), scalar{}, value(obj) {
+    unwrap();
+}
+
+var::var(ObjectPtr&& obj) : kind(Kind::Object), scalar{}, value(std::move(obj)) {
+    unwrap();
+}
 
 var& var::operator=(const ObjectPtr& other) noexcept {
-    value = other;
+    *this = var(other);
     return *this;
 }
 
+// ------------------ Boxing ------------------
+
+void var::unwrap() {
+    if (!value) {
+        kind = Kind::None;
+    } else if (value->type() == TypeTag::Integer) {
+        kind = Kind::Integer;
+        scalar.integer = static_cast<const Integer&>(*value).getValue();
+    } else if (value->type() == TypeTag::Double) {
+        kind = Kind::Double;
+        scalar.real = static_cast<const Double&>(*value).getValue();
+    } else if (value->type() == TypeTag::Boolean) {
+        kind = Kind::Boolean;
+        scalar.boolean = static_cast<const Boolean&>(*value).getValue();
+    }
+}
+
+const ObjectPtr& var::box() const {
+    if (value || kind == Kind::None) {
+        return value;
+    }
+
+    switch (kind) {
+        case Kind::Integer: value = Integer::of(scalar.integer); break;
+        case Kind::Double: value = makeRef<Double>(scalar.real); break;
+        case Kind::Boolean: value = Boolean::of(scalar.boolean); break;
+        default: break;
+    }
+
+    return value;
+}
+
+ObjectPtr& var::materialize() {
+    box();
+    if (kind != Kind::None) {
+        kind = Kind::Object;
+    }
+    return value;
+}
+
+void var::detach() {
+    if (kind == Kind::Object && value.use_count() - value->loops() > 1) {
+        value = value->clone();
+    }
+}
+
 // Access and basic conversion
 var::operator bool() const {
-    if (!value) { return false; }
-    return static_cast<bool>(*value);
+    switch (kind) {
+        case Kind::None: return false;
+        case Kind::Integer: return scalar.integer != 0;
+        case Kind::Double: return scalar.real != 0;
+        case Kind::Boolean: return scalar.boolean;
+        default: return static_cast<bool>(*value);
+    }
 }
 
 var::operator const Object&() const {
-    if (!value) {
+    if (kind == Kind::None) {
         throw std::runtime_error("Cannot convert null var to Object&");
     }
-    return *value;
+    return *box();
 }
 
 var::operator Object&() {
-    if (!value) {
+    if (kind == Kind::None) {
         throw std::runtime_error("Cannot convert null var to Object&");
     }
-    return *value;
+    return *materialize();
 }
 
 var::operator ObjectPtr&() {
-    return value;
+    return materialize();
 }
 
 var::operator const ObjectPtr&() {
-    return value;
+    return box();
 }
 
 ObjectPtr var::operator->() const {
-    return value;
+    return box();
 }
 
 ObjectPtr var::getValue() const {
-    return this->value;
+    return box();
 }
 
 // Comparison operators
 bool var::operator==(const var& other) const {
-    if (!value || !other.value) {
-        if (value == other.value) {
-            return true;
+    if (kind == Kind::None || other.kind == Kind::None) {
+        return kind == other.kind;
+    }
+
+    if (isNumber() && other.isNumber()) {
+        if (kind == Kind::Integer && other.kind == Kind::Integer) {
+            return scalar.integer == other.scalar.integer;
         }
-        return false;
+        return asReal() == other.asReal();
+    }
+
+    if (kind == Kind::Boolean && other.kind == Kind::Boolean) {
+        return scalar.boolean == other.scalar.boolean;
     }
-    return value->equals(*other.value);
+
+    return box()->equals(*other.box());
 }
 
-bool var::operator!=(const var& other) const {
-    if (!value || !other.value) {
-        if (value == other.value) {
+bool var::equals(const Object& other) const {
+    switch (kind) {
+        case Kind::None:
+            return false;
+        case Kind::Integer:
+        case Kind::Double:
+            if (other.type() == TypeTag::Integer) {
+                return asReal() == static_cast<const Integer&>(other).getValue();
+            }
+            if (other.type() == TypeTag::Double) {
+                return asReal() == static_cast<const Double&>(other).getValue();
+            }
             return false;
+        case Kind::Boolean:
+            return other.type() == TypeTag::Boolean
+                && scalar.boolean == static_cast<const Boolean&>(other).getValue();
+        default:
+            return value->equals(other);
+    }
+}
+
+bool var::operator!=(const var& other) const {
+    return !(*this == other);
+}
+
+std::partial_ordering var::compare(const var& other) const {
+    if (kind == Kind::None || other.kind == Kind::None) {
+        return kind == other.kind ? std::partial_ordering::equivalent : std::partial_ordering::unordered;
+    }
+
+    if (isNumber() && other.isNumber()) {
+        if (kind == Kind::Integer && other.kind == Kind::Integer) {
+            return scalar.integer <=> other.scalar.integer;
         }
-        return true;
+        return asReal() <=> other.asReal();
+    }
+
+    if (kind == Kind::Boolean && other.kind == Kind::Boolean) {
+        return scalar.boolean <=> other.scalar.boolean;
     }
-    return !value->equals(*other.value);
+
+    return box()->compare(*other.box());
 }
 
 std::strong_ordering var::operator<=>(const var& other) const {
-    if (*this == other) return std::strong_ordering::equal;
-    if (value->less(*other.value)) return std::strong_ordering::less;
-    if (value->greater(*other.value)) return std::strong_ordering::greater;
+    std::partial_ordering order = compare(other);
+    if (order < 0) return std::strong_ordering::less;
+    if (order > 0) return std::strong_ordering::greater;
+    if (order == 0) return std::strong_ordering::equal;
 
     throw std::runtime_error("Failed three-way comparison");
 }
 
-// Hashing for associative containers
+// Hashing for associative containers, matching the boxed objects' hashes
 std::size_t var::hash() const {
-    return value->hash();
+    switch (kind) {
+        case Kind::None: throw std::runtime_error("Hashing not supported for null values");
+        case Kind::Integer: return std::hash<int32_t>{}(scalar.integer);
+        case Kind::Double: return std::hash<double>{}(scalar.real);
+        case Kind::Boolean: return std::hash<bool>{}(scalar.boolean);
+        default: return value->hash();
+    }
 }
 
 // Arithmetic operators
 var var::operator+(const var& other) const {
-    if (!value || !other.value) {
+    if (isNumber() && other.isNumber()) {
+        if (kind == Kind::Integer && other.kind == Kind::Integer) {
+            return var(scalar.integer + other.scalar.integer);
+        }
+        return var(asReal() + other.asReal());
+    }
+
+    if (kind == Kind::None || other.kind == Kind::None) {
         throw std::runtime_error("Addition not supported for null values");
     }
 
-    return var(value->add(*other.value));
+    return var(box()->add(*other.box()));
 }
 
 var var::operator-(const var& other) const {
-    if (!value || !other.value) {
+    if (isNumber() && other.isNumber()) {
+        if (kind == Kind::Integer && other.kind == Kind::Integer) {
+            return var(scalar.integer - other.scalar.integer);
+        }
+        return var(asReal() - other.asReal());
+    }
+
+    if (kind == Kind::None || other.kind == Kind::None) {
         throw std::runtime_error("Substraction not supported for null values");
     }
 
-    return var(value->subtract(*other.value));
+    return var(box()->subtract(*other.box()));
 }
 
 var var::operator*(const var& other) const {
-    if (!value || !other.value) {
+    if (isNumber() && other.isNumber()) {
+        if (kind == Kind::Integer && other.kind == Kind::Integer) {
+            return var(scalar.integer * other.scalar.integer);
+        }
+        return var(asReal() * other.asReal());
+    }
+
+    if (kind == Kind::None || other.kind == Kind::None) {
         throw std::runtime_error("Multiplication not supported for null values");
     }
 
-    return var(value->multiply(*other.value));
+    return var(box()->multiply(*other.box()));
 }
 
 var var::operator/(const var& other) const {
-    if (!value || !other.value) {
+    if (isNumber() && other.isNumber()) {
+        if (kind == Kind::Integer && other.kind == Kind::Integer) {
+            if (other.scalar.integer == 0) {
+                throw std::runtime_error("Division by zero");
+            }
+            return var(scalar.integer / other.scalar.integer);
+        }
+        return var(asReal() / other.asReal());
+    }
+
+    if (kind == Kind::None || other.kind == Kind::None) {
         throw std::runtime_error("Division not supported for null values");
     }
 
-    return var(value->divide(*other.value));
+    return var(box()->divide(*other.box()));
+}
+
+var& var::operator+=(const var& other) {
+    if (kind == Kind::Object && other.kind == Kind::Object) {
+        switch (value->type()) {
+            case TypeTag::String:
+                // Strings are immutable to everyone else, so only a sole owner appends
+                if (other.value->type() == TypeTag::String && value.use_count() == 1) {
+                    static_cast<String&>(*value).append(static_cast<const String&>(*other.value));
+                    return *this;
+                }
+                break;
+            case TypeTag::List:
+                Call(Methods::extend, {other.value});
+                return *this;
+            default:
+                break;
+        }
+    }
+
+    return *this = *this + other;
+}
+
+var& var::operator-=(const var& other) {
+    return *this = *this - other;
+}
+
+var& var::operator*=(const var& other) {
+    return *this = *this * other;
+}
+
+var& var::operator/=(const var& other) {
+    return *this = *this / other;
 }
 
 var var::operator[](const var& other) const {
-    if (!value || !other.value) {
+    if (kind == Kind::None || other.kind == Kind::None) {
         throw std::runtime_error("Subscript not supported for null values");
     }
 
-    return var(value->subscript(*other.value));
+    return var(box()->subscript(*other.box()));
+}
+
+var::Element var::operator[](const var& other) {
+    if (kind == Kind::None || other.kind == Kind::None) {
+        throw std::runtime_error("Subscript not supported for null values");
+    }
+    return Element(*this, other);
 }
 
 // Print for output
 std::ostream& operator<<(std::ostream& os, const var& variable) {
-    if (variable.value) {
-        variable.value->print(os);
-    } else {
-        os << "None";
+    switch (variable.kind) {
+        case var::Kind::None: os << "None"; break;
+        case var::Kind::Integer: os << variable.scalar.integer; break;
+        case var::Kind::Double: os << variable.scalar.real; break;
+        case var::Kind::Boolean: os << (variable.scalar.boolean ? "True" : "False"); break;
+        default: variable.value->print(os); break;
     }
     return os;
 }
@@ -161,52 +355,89 @@ std::ostream& operator<<(std::ostream& os, const var& variable) {
 // Iterators
 
 Iterator var::getIterator() const {
-if (!value) {
-    throw std::runtime_error("Cannot retrieve iterator from null var");
-}
-return Iterator(value->getIterator());
+    if (kind == Kind::None) {
+        throw std::runtime_error("Cannot retrieve iterator from null var");
+    }
+    return Iterator(box()->getIterator());
 }
 
-Iterator var::cbegin() const {
-    if (!value) {
+Cursor var::cbegin() const {
+    if (kind == Kind::None) {
         throw std::runtime_error("Cannot iterate over null var");
     }
 
-    return Iterator(value->getIterator());
+    return Cursor(box());
 }
 
-Iterator var::cend() const {
-    return Iterator();
+Cursor var::cend() const {
+    return Cursor();
 }
 
-Iterator var::begin() {
-    if (!value) {
-        throw std::runtime_error("Cannot iterate over null var");
-    }
-    return Iterator(value->getIterator());
+Cursor var::begin() {
+    return cbegin();
 }
 
-Iterator var::end() {
-    return Iterator();
+Cursor var::end() {
+    return Cursor();
 }
 
 // Specific methods per instance
-ObjectPtr var::Call(const std::string& name, std::initializer_list<ObjectPtr> params) {
-    if (!value) {
+ObjectPtr var::Call(MethodId id, Args params) {
+    if (kind == Kind::None) {
         throw std::runtime_error("Cannot call method on null var");
     }
 
-    return value->Call(name, params);
+    auto method = box()->getMethods().find(id);
+    if (method && method->mutates) {
+        detach();
+    }
+
+    return value->Call(id, params);
+}
+
+ObjectPtr var::Call(const std::string& name, Args params) {
+    return Call(Methods::intern(name), params);
+}
+
+// ------------------ Element ------------------
+
+var var::Element::get() const {
+    return parent ? parent->get()[key] : std::as_const(*container)[key];
+}
+
+var* var::Element::resolve() const {
+    var* owner = parent ? parent->resolve() : container;
+    if (!owner || owner->kind != Kind::Object) {
+        return nullptr;
+    }
+
+    // The container must be its var's own before one of its elements changes
+    owner->detach();
+    return owner->value->slot(*key.box());
+}
+
+ObjectPtr var::Element::Call(MethodId id, Args params) const&& {
+    var element = get();
+    if (element.kind == Kind::Object) {
+        auto method = element.value->getMethods().find(id);
+        if (method && method->mutates) {
+            // Dropped first, so the stored element is not shared with it
+            element = var();
+            var* slot = resolve();
+            return slot ? slot->Call(id, params) : get().Call(id, params);
+        }
+    }
+    return element.Call(id, params);
 }
 
 // ------------------ Iterator ------------------
 
-Iterator::Iterator(Object::ObjectIt iterator): objectIterator(std::move(iterator)), isEnd(false) {this->init();}
+Iterator::Iterator(Object::ObjectIt iterator): Object(tag), objectIterator(std::move(iterator)), isEnd(false) {}
 
-Iterator::Iterator() : objectIterator(nullptr), isEnd(true) {this->init();}
+Iterator::Iterator() : Object(tag), objectIterator(nullptr), isEnd(true) {}
 
 Iterator::Iterator(const Iterator& other)
-    : objectIterator(other.objectIterator), isEnd(other.isEnd) { this->init(); }
+    : Object(other), objectIterator(other.objectIterator), isEnd(other.isEnd) {}
 
 Iterator& Iterator::operator++() {
     if (!objectIterator || isEnd) {
@@ -233,7 +464,7 @@ var Iterator::operator*() const {
 void Iterator::print(std::ostream& os) const { os << ""; }
 
 ObjectPtr Iterator::clone() const {
-    auto clonedIterator = std::make_shared<Iterator>();
+    auto clonedIterator = makeRef<Iterator>();
 
     if (objectIterator) {
         clonedIterator->objectIterator = objectIterator->clone(); // Assuming objectIterator has a clone method
@@ -251,12 +482,14 @@ var Iterator::operator*() {
     return var(objectIterator->next());
 }
 
-void Iterator::init() {
-    _methods["__next__"] = std::bind(&Iterator::next, this, std::placeholders::_1);
-    _methods["__bool__"] = std::bind(&Iterator::asBoolean, this, std::placeholders::_1);
+const MethodTable& Iterator::getMethods() const {
+    static const MethodTable methods = MethodTable()
+        .add(Methods::next, &Iterator::next, true)
+        .add(Methods::asBoolean, &Iterator::asBoolean);
+    return methods;
 }
 
-Object::Method::result_type Iterator::next(const std::vector<ObjectPtr>& params) {
+Object::Method::result_type Iterator::next(Args params) {
     if (params.size() != 0) {
         throw std::runtime_error("__next__: Invalid number of arguments");
     }
@@ -271,10 +504,10 @@ Object::Method::result_type Iterator::next(const std::vector<ObjectPtr>& params)
     return current.getValue();
 }
 
-Object::Method::result_type Iterator::asBoolean(const std::vector<ObjectPtr>& params) {
+Object::Method::result_type Iterator::asBoolean(Args params) {
     if (params.size() != 0) {
         throw std::runtime_error("__bool__: Invalid number of arguments");
     }
 
-    return std::make_shared<Boolean>(!isEnd && !objectIterator);
+    return Boolean::of(!isEnd && !objectIterator);
 }
\ No newline at end of file
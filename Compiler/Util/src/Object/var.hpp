@@ -2,6 +2,7 @@
 #pragma once
 
 #include <compare>
+#include <cstdint>
 #include <typeindex>
 #include <iostream>
 #include <memory>
@@ -11,6 +12,7 @@
 #include "./object.hpp"
 
 class var;
+class Cursor;
 
 class Iterator : public Object{
   private:
@@ -20,10 +22,9 @@ class Iterator : public Object{
     // Whether the end has been reached or not
     bool isEnd;
 
-    // Register methods
-    void init();
-
  public:
+  static constexpr TypeTag tag = TypeTag::Iterator;
+
   // Constructor for a valid iterator
   explicit Iterator(Object::ObjectIt iterator);
 
@@ -36,6 +37,7 @@ class Iterator : public Object{
   // Inherited methods from Object 
   void print(std::ostream& os) const override;
   ObjectPtr clone() const override;
+  const MethodTable& getMethods() const override;
 
   // De-referencing
   var operator*() const;
@@ -45,23 +47,58 @@ class Iterator : public Object{
   Iterator& operator++();
 
   // Get next iterator after this one
-  Method::result_type next(const std::vector<ObjectPtr>& params);
+  Method::result_type next(Args params);
 
   // True if this iterator has a next one
-  Method::result_type asBoolean(const std::vector<ObjectPtr>& params);
+  Method::result_type asBoolean(Args params);
 
   // Comparison
   bool operator!=(const Iterator& other) const;
 };
 
 class var {
+ public:
+  // Storage kind of the held value, scalars are kept inline
+  enum class Kind : uint8_t { None, Integer, Double, Boolean, Object };
+
  private:
-  ObjectPtr value;
+  Kind kind;
+
+  // Inline storage for scalar kinds
+  union {
+    int32_t integer;
+    double real;
+    bool boolean;
+  } scalar;
+
+  // Heap object for the Object kind, or a lazily boxed copy of the scalar
+  mutable ObjectPtr value;
+
+  // Box inline scalar into a heap object, cached for later accesses
+  const ObjectPtr& box() const;
+
+  // Move inline scalar to the heap for good, since it may be mutated
+  ObjectPtr& materialize();
+
+  // Keep scalar objects inline after adopting an ObjectPtr
+  void unwrap();
+
+  // Give this var its own copy of a shared object before it gets mutated.
+  // Loops walking the object (see Collections/Cursor.hpp) don't share it
+  void detach();
+
+  inline bool isNumber() const {
+    return kind == Kind::Integer || kind == Kind::Double;
+  }
+
+  inline double asReal() const {
+    return kind == Kind::Integer ? scalar.integer : scalar.real;
+  }
 
  public:
   var();
   template <typename T, typename = std::enable_if_t<std::is_base_of<Object, T>::value>>
-  implicit var(const T& value) : value(std::make_shared<T>(value)) { }
+  implicit var(const T& value) : var(ObjectPtr(makeRef<T>(value))) { }
 
   // Specialized constructors for base types
   implicit var(int32_t value);
@@ -76,9 +113,11 @@ class var {
 
   // Move constructor and assignment
   var(var&& other) noexcept;
+  var& operator=(var&& other) noexcept;
 
   // Copy-assignment from ObjPtr
   implicit var(const ObjectPtr& obj);
+  implicit var(ObjectPtr&& obj);
   implicit var& operator=(const ObjectPtr& other) noexcept;
 
   // Access and basic conversion
@@ -96,16 +135,30 @@ class var {
 
   ObjectPtr getValue() const;
 
+  inline Kind getKind() const { return kind; }
+
+  // Inline scalar of an Integer or Double var, without boxing it
+  inline int32_t integerValue() const { return scalar.integer; }
+  inline double realValue() const { return scalar.real; }
+
   template<typename ObjectType>
-  std::shared_ptr<ObjectType> as() {
-    return std::dynamic_pointer_cast<ObjectType>(value);
+  Ref<ObjectType> as() {
+    return objectCast<ObjectType>(box());
   }
 
   // Comparison operators
   bool operator==(const var& other) const;
 
+  // Same as == against a borrowed object, without boxing scalars
+  bool equals(const Object& other) const;
+
   bool operator!=(const var& other) const;
 
+  // Three-way comparison with a single dispatch, unordered when the two
+  // cannot be ordered (None only compares equal to None)
+  std::partial_ordering compare(const var& other) const;
+
+  // Same as compare(), but throws when unordered
   std::strong_ordering operator<=>(const var& other) const;
 
   // Hashing for associative containers
@@ -120,25 +173,71 @@ class var {
 
   var operator/(const var& other) const;
 
+  // Compound assignment. Appends to a string nobody else holds and extends
+  // lists in place, anything else is rebound to the result of the operator
+  var& operator+=(const var& other);
+
+  var& operator-=(const var& other);
+
+  var& operator*=(const var& other);
+
+  var& operator/=(const var& other);
+
   var operator[](const var& other) const;
 
+  // Element of this var's container, to call a mutating method on in place
+  class Element;
+  Element operator[](const var& other);
+
   // Print for output
   friend std::ostream& operator<<(std::ostream& os, const var& variable);
 
  public:
-  // Provide `begin()` and `end()` methods for range-based for loops
+  // Iterator object, as returned by iter()
   Iterator getIterator() const;
-  
-  Iterator cbegin() const;
 
-  Iterator cend() const;
+  // Provide `begin()` and `end()` methods for range-based for loops (see Collections/Cursor.hpp)
+  Cursor cbegin() const;
 
-  Iterator begin();
+  Cursor cend() const;
 
-  Iterator end();
+  Cursor begin();
+
+  Cursor end();
 
   // Specific methods per instance
-  ObjectPtr Call(const std::string& name, std::initializer_list<ObjectPtr> params);
+  ObjectPtr Call(MethodId id, Args params);
+  ObjectPtr Call(const std::string& name, Args params);
+};
+
+// Subscript of a var, as the receiver of a method call (`x[0].append(1)`).
+// Mutating methods change the element stored in the container, which this
+// var takes its own copy of first. Stored elements are reached again on each
+// call, so an Element is only ever used as a temporary within one expression
+class var::Element {
+ private:
+  // The var subscripted, or the element it is nested in (`x[0][1]`)
+  var* container;
+  const Element* parent;
+  var key;
+
+  // Stored element to change in place, or null when it cannot be reached
+  var* resolve() const;
+
+ public:
+  Element(var& container, const var& key) : container(&container), parent(nullptr), key(key) {}
+  Element(const Element& parent, const var& key) : container(nullptr), parent(&parent), key(key) {}
+
+  Element(const Element&) = delete;
+  Element& operator=(const Element&) = delete;
+
+  // Current value of the element
+  var get() const;
+  implicit operator var() const&& { return get(); }
+
+  Element operator[](const var& other) const&& { return Element(*this, other); }
+
+  ObjectPtr Call(MethodId id, Args params) const&&;
 };
 
 // Hashing for var in associative containers
@@ -148,3 +247,20 @@ namespace std {
     { return s.hash();}
   };
 }
+
+// Transparent hashing and equality of var keys, so associative containers
+// can also look up a borrowed Object without wrapping it in a var
+struct VarHash {
+  using is_transparent = void;
+
+  inline std::size_t operator()(const var& key) const { return key.hash(); }
+  inline std::size_t operator()(const Object& key) const { return key.hash(); }
+};
+
+struct VarEqual {
+  using is_transparent = void;
+
+  inline bool operator()(const var& lhs, const var& rhs) const { return lhs == rhs; }
+  inline bool operator()(const var& lhs, const Object& rhs) const { return lhs.equals(rhs); }
+  inline bool operator()(const Object& lhs, const var& rhs) const { return rhs.equals(lhs); }
+};
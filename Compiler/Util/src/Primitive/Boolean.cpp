@@ -4,8 +4,17 @@
 
 Boolean::Boolean(bool value) : Primitive(value) {}
 
+ObjectPtr Boolean::of(bool value) {
+    static Boolean* const constants[2] = {
+        [] { Boolean* constant = new Boolean(false); constant->makeImmortal(); return constant; }(),
+        [] { Boolean* constant = new Boolean(true); constant->makeImmortal(); return constant; }()
+    };
+
+    return ObjectPtr(constants[value]);
+}
+
 Boolean::operator ObjectPtr() {
-    return std::make_shared<Boolean>(*this);
+    return Boolean::of(this->value);
 };
 
 Boolean::operator bool() const { return this->value; }
@@ -14,23 +23,25 @@ void Boolean::print(std::ostream& os) const {
     os << ((this->value)? "True" : "False");
 }
 
-void Boolean::init() {
-    _methods["__bool__"] = std::bind(&Boolean::asBool, this, std::placeholders::_1);
-    _methods["__str__"] = std::bind(&Boolean::asString, this, std::placeholders::_1);
+const MethodTable& Boolean::getMethods() const {
+    static const MethodTable methods = MethodTable()
+        .add(Methods::asBoolean, &Boolean::asBool)
+        .add(Methods::asString, &Boolean::asString);
+    return methods;
 }
 
-Boolean::Method::result_type Boolean::asBool(const std::vector<ObjectPtr>& params) {
+Boolean::Method::result_type Boolean::asBool(Args params) {
     if (params.size() != 0) {
       throw std::runtime_error("__bool__: Invalid number of arguments");
     }
 
-    return std::make_shared<Boolean>(*this);
+    return Boolean::of(this->value);
 }
 
-Boolean::Method::result_type Boolean::asString(const std::vector<ObjectPtr>& params) {
+Boolean::Method::result_type Boolean::asString(Args params) {
     if (params.size() != 0) {
       throw std::runtime_error("__str__: Invalid number of arguments");
     }
 
-    return std::make_shared<String>(this->value ? "True" : "False");
+    return makeRef<String>(this->value ? "True" : "False");
 }
@@ -5,18 +5,23 @@
 
 // Boolean class
 class Boolean : public Primitive<Boolean, bool> {
- private:
-  void init();
  public:
+  static constexpr TypeTag tag = TypeTag::Boolean;
+
   explicit Boolean(bool value);
 
+  // Shared immortal True or False
+  static ObjectPtr of(bool value);
+
   operator ObjectPtr() override;
 
   operator bool() const override;
 
   void print(std::ostream& os) const override;
 
-  Method::result_type asBool(const std::vector<ObjectPtr>& params);
+  const MethodTable& getMethods() const override;
+
+  Method::result_type asBool(Args params);
 
-  Method::result_type asString(const std::vector<ObjectPtr>& params);
+  Method::result_type asString(Args params);
 };
@@ -4,9 +4,9 @@
 #include "./String.hpp"
 
 namespace Builtin {
-    var asString(const std::vector<ObjectPtr> &params) {
+    var asString(Args params) {
         if (params.size() == 0) {
-            return (var) std::make_shared<String>("");
+            return (var) makeRef<String>("");
         }
 
         if (params.size() > 1) {
@@ -20,12 +20,12 @@ namespace Builtin {
             return nullptr;
         }
 
-        return (var) obj->Call("__str__", {});
+        return (var) obj->Call(Methods::asString, {});
     }
 
-    var asBoolean(const std::vector<ObjectPtr>& params) {
+    var asBoolean(Args params) {
         if (params.size() == 0) {
-            return (var) std::make_shared<Boolean>(false);
+            return (var) Boolean::of(false);
         }
 
         if (params.size() > 1) {
@@ -39,7 +39,24 @@ namespace Builtin {
             return nullptr;
         }
 
-        return (var) obj->Call("__bool__", {});
+        return (var) obj->Call(Methods::asBoolean, {});
     }
 
+    var intern(Args params) {
+        if (params.size() != 1) {
+            std::cerr << "intern: Invalid number of arguments\n";
+            return nullptr;
+        }
+
+        auto string = objectCast<String>(params[0]);
+        if (! string) {
+            std::cerr << "intern: Argument must be a string.\n";
+            return nullptr;
+        }
+
+        if (string->isInterned()) {
+            return (var) params[0];
+        }
+        return (var) String::intern(string->getValue());
+    }
 }
\ No newline at end of file
@@ -6,8 +6,11 @@
 // Implement orphan built in functions
 namespace Builtin {
   // Get variable representation as string
-  var asString(const std::vector<ObjectPtr>& params);
+  var asString(Args params);
 
   // Get variable representation as boolean
-  var asBoolean(const std::vector<ObjectPtr>& params);
+  var asBoolean(Args params);
+
+  // Get the shared interned copy of a string
+  var intern(Args params);
 }
\ No newline at end of file
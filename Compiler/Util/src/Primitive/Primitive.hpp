@@ -10,7 +10,7 @@ class Primitive : public Object {
   ValueType value;
 
  public:
-  explicit Primitive(ValueType value) : value(std::move(value)) {}
+  explicit Primitive(ValueType value) : Object(Derived::tag), value(std::move(value)) {}
   ~Primitive() override = default;
   inline const ValueType& getValue() const { return value; }
 
@@ -19,7 +19,7 @@ class Primitive : public Object {
   // Print inner value contents
   inline void print(std::ostream& os) const override {
     #ifdef DEBUG
-      os << typeid(Derived).name() << ": " << value;
+      os << typeName(Derived::tag) << ": " << value;
     #else
       os << value;
     #endif
@@ -27,7 +27,7 @@ class Primitive : public Object {
 
   // Clone self
   inline ObjectPtr clone() const override {
-    return std::make_shared<Derived>(value);
+    return makeRef<Derived>(value);
   }
 
   // ------------------ Native operators ------------------
@@ -46,24 +46,11 @@ class Primitive : public Object {
     return std::hash<ValueType>{}(value);
   }
 
-  virtual bool equals(const Object& other) const {
-    if (!isSameType(other)) { return false ;}
+  // Ordered by inner value, unordered against other types
+  std::partial_ordering compare(const Object& other) const override {
+    if (!isSameType(other)) { return std::partial_ordering::unordered; }
 
-    auto otherObj = dynamic_cast<const Primitive<Derived, ValueType>&>(other);
-    return this->value == otherObj.getValue();
+    auto& otherObj = static_cast<const Primitive<Derived, ValueType>&>(other);
+    return this->value <=> otherObj.getValue();
   }
-
-  virtual bool less(const Object& other) const {
-    if (!isSameType(other)) { return false ;}
-
-    auto otherObj = dynamic_cast<const Primitive<Derived, ValueType>&>(other);
-    return this->value < otherObj.getValue();
-  }
-
-  virtual bool greater(const Object& other) const {
-    if (!isSameType(other)) { return false ;}
-
-    auto otherObj = dynamic_cast<const Primitive<Derived, ValueType>&>(other);
-    return this->value > otherObj.getValue();
-  }  
 };
@@ -1,81 +1,393 @@
 // Copyright (c) 2024 Syntax Errors.
 #include <algorithm>
+#include <mutex>
+#include <unordered_map>
 
 #include "./String.hpp"
+#include "./StringKernels.hpp"
 #include "./Boolean.hpp"
+#include "../Collections/Cursor.hpp"  // NOLINT
+#include "../Collections/List.hpp"    // NOLINT
 #include "../Numeric/Integer.hpp"     // NOLINT
 #include "../functions.hpp"           // NOLINT
+#include "../Collections/Tuple.hpp"   // NOLINT
 
-void String::init() {
-    _methods["slice"] = std::bind(&String::slice, this, std::placeholders::_1);
-    _methods["__len__"] = std::bind(&String::len, this, std::placeholders::_1);
-    _methods["__bool__"] = std::bind(&String::asBool, this, std::placeholders::_1);
-    _methods["__str__"] = std::bind(&String::asString, this, std::placeholders::_1);
+namespace {
+    // String argument of a method, or null when it is None or absent
+    Ref<String> stringArgument(Args params, std::size_t index, const char* method) {
+        if (index >= params.size() || !params[index]) {
+            return nullptr;
+        }
+
+        auto string = objectCast<String>(params[index]);
+        if (!string) {
+            throw std::runtime_error(std::string(method) + ": Argument must be a string");
+        }
+        return string;
+    }
+
+    // Part of `string` selected by optional start and end arguments from `index` on,
+    // like string[start:end], with `offset` its first byte. False when start lies
+    // past the end of the string
+    bool searchWindow(const String& string, Args params, std::size_t index, std::size_t& offset, std::string_view& window) {
+        const int size = static_cast<int>(string.characterCount());
+        int bounds[2] = {0, size};
+
+        for (std::size_t bound = 0; bound < 2 && index + bound < params.size(); ++bound) {
+            if (!params[index + bound]) {
+                continue;
+            }
+            auto integer = objectCast<Integer>(params[index + bound]);
+            if (!integer) {
+                throw std::runtime_error("Slice indices must be integers or None");
+            }
+            bounds[bound] = integer->getValue();
+        }
+
+        if (bounds[0] > size) {
+            return false;
+        }
+        for (int& bound : bounds) {
+            bound = std::clamp(bound < 0 ? bound + size : bound, 0, size);
+        }
+
+        offset = string.byteOffset(bounds[0]);
+        std::size_t end = bounds[1] > bounds[0] ? string.byteOffset(bounds[1]) : offset;
+        window = string.view().substr(offset, end - offset);
+        return true;
+    }
+}
+
+String::String(std::string value) : Primitive(std::move(value)) {}
+
+String::String(const String& other) : Primitive(std::string()), _hash(other._hash) {
+    // The code point index is rebuilt when needed
+    if (other._encoding != Encoding::Utf8) {
+        _encoding = other._encoding;
+    }
+
+    other.unpin();
+    if (other._base) {
+        _base = other._base;
+        _offset = other._offset;
+        _length = other._length;
+    } else {
+        value = other.value;
+    }
+}
+
+// ------------------ Views ------------------
+
+void String::materialize() const {
+    // The contents stay the same, only where they are stored changes
+    const_cast<std::string&>(value).assign(view());
+    _base.reset();
+    _offset = 0;
+    _length = 0;
+}
+
+void String::unpin() const {
+    if (_base && _base.use_count() == 1 && _length * pinRatio < _base->value.size()) {
+        materialize();
+    }
+}
+
+Ref<String> String::buffer() const {
+    unpin();
+    return _base ? _base : Ref<String>(const_cast<String*>(this));
+}
+
+ObjectPtr String::substring(std::size_t start, std::size_t length) const {
+    std::string_view text = view();
+    if (start == 0 && length == text.size()) {
+        return ObjectPtr(const_cast<String*>(this));
+    }
+    if (length == 1) {
+        return String::of(text[start]);
+    }
+    if (length < minimumViewLength) {
+        return makeRef<String>(std::string(text.substr(start, length)));
+    }
+
+    Ref<String> piece = makeRef<String>(std::string());
+    piece->_base = _base ? _base : Ref<String>(const_cast<String*>(this));
+    piece->_offset = _offset + start;
+    piece->_length = length;
+
+    // Pieces of ASCII text need no scan of their own
+    if (_encoding == Encoding::Ascii) {
+        piece->_encoding = Encoding::Ascii;
+    }
+    return piece;
 }
 
- String::String(std::string value) : Primitive(std::move(value)) { init(); }
+// ------------------ Characters ------------------
+
+void String::scan() const {
+    StringKernels::Utf8Scan result = StringKernels::scanUtf8(view());
+    if (!result.valid) {
+        _encoding = Encoding::Invalid;
+    } else if (result.ascii) {
+        _encoding = Encoding::Ascii;
+    } else {
+        _encoding = Encoding::Utf8;
+        _utf8 = std::make_unique<Utf8Index>(Utf8Index{result.characters, {}});
+    }
+}
+
+const std::vector<std::size_t>& String::characterOffsets() const {
+    std::vector<std::size_t>& offsets = _utf8->offsets;
+    if (offsets.empty()) {
+        std::string_view text = view();
+        offsets.reserve(_utf8->characters / indexStride + 1);
+
+        std::size_t offset = 0;
+        for (std::size_t character = 0; character < _utf8->characters; ++character) {
+            if (character % indexStride == 0) {
+                offsets.push_back(offset);
+            }
+            offset += StringKernels::sequenceLength(text[offset]);
+        }
+    }
+    return offsets;
+}
+
+std::size_t String::byteOffset(std::size_t character) const {
+    if (indexesBytes()) {
+        return std::min(character, view().size());
+    }
+    if (character >= _utf8->characters) {
+        return view().size();
+    }
+
+    // Walk from the closest indexed character before this one
+    std::string_view text = view();
+    std::size_t offset = characterOffsets()[character / indexStride];
+    for (std::size_t remaining = character % indexStride; remaining > 0; --remaining) {
+        offset += StringKernels::sequenceLength(text[offset]);
+    }
+    return offset;
+}
+
+std::size_t String::characterIndex(std::size_t offset) const {
+    if (indexesBytes()) {
+        return offset;
+    }
+
+    // Count from the closest indexed character before the offset
+    const std::vector<std::size_t>& offsets = characterOffsets();
+    std::size_t entry = std::upper_bound(offsets.begin(), offsets.end(), offset) - offsets.begin() - 1;
+    return entry * indexStride + StringKernels::countCharacters(view().substr(offsets[entry], offset - offsets[entry]));
+}
 
 // ------------------ Native overrides ------------------
 
-String::Method::result_type String::slice(const std::vector<ObjectPtr>& params) {
-    return generalizedSlice(
-        this->value,
-        params,
-        [](std::string& result, const char& element) { result += element; },
-        [](const std::string& resultContainer) {
-        return std::make_shared<String>(resultContainer);
+void String::print(std::ostream& os) const {
+    unpin();
+    #ifdef DEBUG
+        os << typeName(tag) << ": " << view();
+    #else
+        os << view();
+    #endif
+}
+
+ObjectPtr String::clone() const {
+    return makeRef<String>(*this);
+}
+
+String::Method::result_type String::slice(Args params) {
+    unpin();
+    std::string_view text = view();
+    SliceBounds bounds = sliceBounds(characterCount(), params);
+
+    if (bounds.step == 1) {
+        if (bounds.end <= bounds.start) {
+            return substring(0, 0);
+        }
+        std::size_t start = byteOffset(bounds.start);
+        return substring(start, byteOffset(bounds.end) - start);
+    }
+
+    // Bytes of the character at an index
+    auto character = [&](std::size_t index) {
+        if (indexesBytes()) {
+            return text.substr(index, 1);
+        }
+        std::size_t offset = byteOffset(index);
+        return text.substr(offset, StringKernels::sequenceLength(text[offset]));
+    };
+
+    std::string result;
+    if (bounds.step > 0) {
+        for (size_t i = bounds.start; i < bounds.end; i += bounds.step) {
+            result += character(i);
+        }
+    } else {
+        for (int i = static_cast<int>(bounds.start); i >= static_cast<int>(bounds.end); i += bounds.step) {
+            if (static_cast<size_t>(i) < characterCount()) {
+                result += character(i);
+            }
         }
-    );    // NOLINT
+    }
+    return makeRef<String>(std::move(result));
 }
 
 // ------------------ Native operators ------------------
 
 String::operator ObjectPtr() {
-    return std::make_shared<String>(*this);
+    return makeRef<String>(*this);
 };
 
 ObjectPtr String::add(const Object& other) const {
-    auto otherObj = dynamic_cast<const String*>(&other);
+    auto otherObj = objectCast<String>(&other);
     if (otherObj) {
-        return std::make_shared<String>(value + otherObj->getValue());
+        std::string_view lhs = view();
+        std::string_view rhs = otherObj->view();
+
+        std::string result;
+        result.reserve(lhs.size() + rhs.size());
+        result.append(lhs);
+        result.append(rhs);
+        return makeRef<String>(std::move(result));
     }
 
     throw std::runtime_error("Cannot concat non string type");
 }
 
 ObjectPtr String::subscript(const Object& other) const  {
-    auto otherObj = dynamic_cast<const Integer*>(&other);
+    auto otherObj = objectCast<Integer>(&other);
     if (otherObj) {
-        auto result = value[otherObj->getValue()];
-        return std::make_shared<String>(std::string(1, result));
+        std::string_view text = view();
+        const int size = static_cast<int>(characterCount());
+        int index = otherObj->getValue();
+        if (index < 0) {
+            index += size;
+        }
+        if (index < 0 || index >= size) {
+            throw std::out_of_range("String index out of range");
+        }
+        if (indexesBytes()) {
+            return String::of(text[index]);
+        }
+        std::size_t offset = byteOffset(index);
+        return String::of(text.substr(offset, StringKernels::sequenceLength(text[offset])));
     }
 
     throw std::runtime_error("Cannot Index with non integer type");
 }
 
 String String::operator+(const String& other) {
-    return String(this->value + other.value);
+    return String(std::string(view()) + std::string(other.view()));
 }
 
 String String::operator+(const std::string& other) {
-    return String(this->value + other);
+    return String(std::string(view()) + other);
 }
 
 String String::operator+(const char* other) {
-    return String(this->value + std::string(other));
+    return String(std::string(view()) + std::string(other));
 }
 
 String String::operator+(const char other) {
-    return String(this->value + other);
+    return String(std::string(view()) + other);
 }
 
 String::operator bool() const  {
-    return value.empty();
+    return view().empty();
+}
+
+std::size_t String::hash() const {
+    unpin();
+    return _hash.get([this] { return std::hash<std::string_view>{}(view()); });
+}
+
+void String::append(const String& other) {
+    if (_base) {
+        materialize();
+    }
+    value.append(other.view());
+    _hash.reset();
+
+    // ASCII stays ASCII, anything else is scanned again when needed
+    if (_encoding != Encoding::Ascii || other._encoding != Encoding::Ascii) {
+        _encoding = Encoding::Unknown;
+        _utf8.reset();
+    }
+}
+
+bool String::equals(const Object& other) const {
+    if (this == &other) {
+        return true;
+    }
+    if (!isSameType(other)) {
+        return false;
+    }
+
+    // Two interned strings with the same contents are the same object
+    auto& otherString = static_cast<const String&>(other);
+    if (interned && otherString.interned) {
+        return false;
+    }
+    return view() == otherString.view();
+}
+
+// Byte order of UTF-8 is code point order, as Python compares strings
+std::partial_ordering String::compare(const Object& other) const {
+    if (!isSameType(other)) { return std::partial_ordering::unordered; }
+
+    return view() <=> static_cast<const String&>(other).view();
+}
+
+ObjectPtr String::of(char character) {
+    static String* const* characters = [] {
+        static String* table[256];
+        for (int code = 0; code < 256; ++code) {
+            table[code] = new String(std::string(1, static_cast<char>(code)));
+            table[code]->makeImmortal();
+            table[code]->interned = true;
+        }
+        return table;
+    }();
+
+    return ObjectPtr(characters[static_cast<unsigned char>(character)]);
+}
+
+ObjectPtr String::of(std::string_view character) {
+    if (character.size() == 1) {
+        return String::of(character[0]);
+    }
+    return makeRef<String>(std::string(character));
+}
+
+ObjectPtr String::intern(std::string_view text) {
+    if (text.size() == 1) {
+        return String::of(text[0]);
+    }
+
+    // Keys view the contents of the immortal strings they map to
+    static std::mutex tableLock;
+    static auto* table = new std::unordered_map<std::string_view, String*>();
+
+    std::lock_guard<std::mutex> guard(tableLock);
+    auto match = table->find(text);
+    if (match != table->end()) {
+        return ObjectPtr(match->second);
+    }
+
+    String* string = new String(std::string(text));
+    string->makeImmortal();
+    string->interned = true;
+    string->hash();
+    string->scan();
+    table->emplace(string->value, string);
+
+    return ObjectPtr(string);
 }
 
 // ------------------ Iteration ------------------
 
-String::StringIterator::StringIterator(const std::string& str) : str(str), currentIndex(0) {}
+String::StringIterator::StringIterator(const String& string)
+    : owner(string.buffer()), str(string.view()), currentIndex(0), utf8(!string.indexesBytes()) {}
 
 bool String::StringIterator::hasNext() const  {
     return currentIndex < str.size();
@@ -86,39 +398,396 @@ ObjectPtr String::StringIterator::next()  {
     throw std::out_of_range("Iterator out of range");
     }
     // Wrap each character as a `String` object
-    return std::make_shared<String>(std::string(1, str[currentIndex++]));
+    std::size_t length = utf8 ? StringKernels::sequenceLength(str[currentIndex]) : 1;
+    currentIndex += length;
+    return String::of(str.substr(currentIndex - length, length));
 }
 
 String::ObjectIt String::StringIterator::clone() const {
-    return std::make_shared<StringIterator>(*this);
+    return makeIterator<StringIterator>(*this);
 }
 
 String::ObjectIt String::getIterator() const  {
-    return std::make_shared<StringIterator>(value);
+    return makeIterator<StringIterator>(*this);
 }
 
 // ------------------ Management Methods ------------------
 
-String::Method::result_type String::len(const std::vector<ObjectPtr>& params) {
+const MethodTable& String::getMethods() const {
+    static const MethodTable methods = MethodTable()
+        .add(Methods::slice, &String::slice)
+        .add(Methods::join, &String::join)
+        .add(Methods::split, &String::split)
+        .add(Methods::find, &String::find)
+        .add(Methods::rfind, &String::rfind)
+        .add(Methods::count, &String::count)
+        .add(Methods::replace, &String::replace)
+        .add(Methods::startswith, &String::startswith)
+        .add(Methods::endswith, &String::endswith)
+        .add(Methods::strip, &String::strip)
+        .add(Methods::upper, &String::upper)
+        .add(Methods::lower, &String::lower)
+        .add(Methods::len, &String::len)
+        .add(Methods::asBoolean, &String::asBool)
+        .add(Methods::asString, &String::asString);
+    return methods;
+}
+
+String::Method::result_type String::join(Args params) {
+    if (params.size() != 1) {
+      throw std::runtime_error("join: Invalid number of arguments");
+    }
+
+    // Hold every piece first, so the result is allocated once at its final size
+    std::vector<Ref<String>> pieces;
+    std::size_t length = 0;
+    var iterable = params[0];
+    for (const var& piece : iterable) {
+        auto string = objectCast<String>(piece.getValue());
+        if (!string) {
+            throw std::runtime_error("join: Sequence item must be a string");
+        }
+        length += string->view().size();
+        pieces.push_back(std::move(string));
+    }
+
+    std::string_view separator = view();
+    if (!pieces.empty()) {
+        length += separator.size() * (pieces.size() - 1);
+    }
+
+    std::string result;
+    result.reserve(length);
+    for (std::size_t index = 0; index < pieces.size(); ++index) {
+        if (index > 0) {
+            result.append(separator);
+        }
+        result.append(pieces[index]->view());
+    }
+
+    return makeRef<String>(std::move(result));
+}
+
+// Pieces share this string's bytes where they are long enough (see substring)
+String::Method::result_type String::split(Args params) {
+    if (params.size() > 2) {
+      throw std::runtime_error("split: Invalid number of arguments");
+    }
+
+    Ref<String> separator = params.size() > 0 && params[0] ? objectCast<String>(params[0]) : nullptr;
+    if (params.size() > 0 && params[0] && !separator) {
+        throw std::runtime_error("split: Separator must be a string");
+    }
+
+    int maxSplit = -1;
+    if (params.size() > 1) {
+        auto limit = objectCast<Integer>(params[1]);
+        if (!limit) {
+            throw std::runtime_error("split: Maximum number of splits must be an integer");
+        }
+        maxSplit = limit->getValue();
+    }
+
+    unpin();
+    std::string_view text = view();
+    std::vector<var> pieces;
+
+    if (separator) {
+        std::string_view delimiter = separator->view();
+        if (delimiter.empty()) {
+            throw std::runtime_error("split: Empty separator");
+        }
+
+        std::size_t start = 0;
+        while (maxSplit < 0 || static_cast<int>(pieces.size()) < maxSplit) {
+            std::size_t match = StringKernels::find(text, delimiter, start);
+            if (match == StringKernels::npos) {
+                break;
+            }
+            pieces.emplace_back(substring(start, match - start));
+            start = match + delimiter.size();
+        }
+        pieces.emplace_back(substring(start, text.size() - start));
+    } else {
+        // Runs of whitespace separate pieces, leading and trailing ones are dropped
+        using StringKernels::isSpace;
+
+        std::size_t position = 0;
+        while (true) {
+            while (position < text.size() && isSpace(text[position])) {
+                ++position;
+            }
+            if (position == text.size()) {
+                break;
+            }
+
+            // The rest is kept whole, trailing whitespace included
+            if (maxSplit >= 0 && static_cast<int>(pieces.size()) == maxSplit) {
+                pieces.emplace_back(substring(position, text.size() - position));
+                break;
+            }
+
+            std::size_t start = position;
+            while (position < text.size() && !isSpace(text[position])) {
+                ++position;
+            }
+            pieces.emplace_back(substring(start, position - start));
+        }
+    }
+
+    return makeRef<List>(pieces);
+}
+
+String::Method::result_type String::find(Args params) {
+    if (params.size() < 1 || params.size() > 3) {
+      throw std::runtime_error("find: Invalid number of arguments");
+    }
+
+    Ref<String> pattern = stringArgument(params, 0, "find");
+    if (!pattern) {
+        throw std::runtime_error("find: Argument must be a string");
+    }
+
+    std::size_t offset = 0;
+    std::string_view window;
+    if (!searchWindow(*this, params, 1, offset, window)) {
+        return Integer::of(-1);
+    }
+
+    std::size_t match = StringKernels::find(window, pattern->view());
+    return Integer::of(match == StringKernels::npos ? -1 : static_cast<int32_t>(characterIndex(offset + match)));
+}
+
+String::Method::result_type String::rfind(Args params) {
+    if (params.size() < 1 || params.size() > 3) {
+      throw std::runtime_error("rfind: Invalid number of arguments");
+    }
+
+    Ref<String> pattern = stringArgument(params, 0, "rfind");
+    if (!pattern) {
+        throw std::runtime_error("rfind: Argument must be a string");
+    }
+
+    std::size_t offset = 0;
+    std::string_view window;
+    if (!searchWindow(*this, params, 1, offset, window)) {
+        return Integer::of(-1);
+    }
+
+    std::size_t match = StringKernels::rfind(window, pattern->view());
+    return Integer::of(match == StringKernels::npos ? -1 : static_cast<int32_t>(characterIndex(offset + match)));
+}
+
+String::Method::result_type String::count(Args params) {
+    if (params.size() < 1 || params.size() > 3) {
+      throw std::runtime_error("count: Invalid number of arguments");
+    }
+
+    Ref<String> pattern = stringArgument(params, 0, "count");
+    if (!pattern) {
+        throw std::runtime_error("count: Argument must be a string");
+    }
+
+    std::size_t offset = 0;
+    std::string_view window;
+    if (!searchWindow(*this, params, 1, offset, window)) {
+        return Integer::of(0);
+    }
+
+    // An empty pattern matches between characters, not bytes
+    if (pattern->view().empty() && !indexesBytes()) {
+        return Integer::of(StringKernels::countCharacters(window) + 1);
+    }
+    return Integer::of(StringKernels::count(window, pattern->view()));
+}
+
+String::Method::result_type String::replace(Args params) {
+    if (params.size() < 2 || params.size() > 3) {
+      throw std::runtime_error("replace: Invalid number of arguments");
+    }
+
+    Ref<String> pattern = stringArgument(params, 0, "replace");
+    Ref<String> replacement = stringArgument(params, 1, "replace");
+    if (!pattern || !replacement) {
+        throw std::runtime_error("replace: Argument must be a string");
+    }
+
+    int limit = -1;
+    if (params.size() > 2 && params[2]) {
+        auto integer = objectCast<Integer>(params[2]);
+        if (!integer) {
+            throw std::runtime_error("replace: Count must be an integer");
+        }
+        limit = integer->getValue();
+    }
+
+    std::string_view text = view();
+    if (limit == 0 || (!pattern->view().empty() && StringKernels::find(text, pattern->view()) == StringKernels::npos)) {
+        return ObjectPtr(const_cast<String*>(this));
+    }
+
+    // An empty pattern goes between characters, keeping multi-byte ones whole
+    if (pattern->view().empty() && !indexesBytes()) {
+        std::string result;
+        std::size_t replaced = 0;
+        for (std::size_t offset = 0; offset <= text.size(); ++replaced) {
+            if (limit >= 0 && replaced >= static_cast<std::size_t>(limit)) {
+                result.append(text.substr(offset));
+                break;
+            }
+            result.append(replacement->view());
+            if (offset == text.size()) {
+                break;
+            }
+            std::size_t length = StringKernels::sequenceLength(text[offset]);
+            result.append(text.substr(offset, length));
+            offset += length;
+        }
+        return makeRef<String>(std::move(result));
+    }
+
+    return makeRef<String>(StringKernels::replace(text, pattern->view(), replacement->view(), limit));
+}
+
+String::Method::result_type String::startswith(Args params) {
+    if (params.size() < 1 || params.size() > 3) {
+      throw std::runtime_error("startswith: Invalid number of arguments");
+    }
+
+    std::size_t offset = 0;
+    std::string_view window;
+    if (!searchWindow(*this, params, 1, offset, window)) {
+        return Boolean::of(false);
+    }
+
+    // A tuple matches when any of its prefixes does
+    if (params[0] && params[0]->type() == TypeTag::Tuple) {
+        for (const var& prefix : static_cast<const Tuple&>(*params[0]).getValue()) {
+            auto string = objectCast<String>(prefix.getValue());
+            if (!string) {
+                throw std::runtime_error("startswith: Tuple items must be strings");
+            }
+            if (window.starts_with(string->view())) {
+                return Boolean::of(true);
+            }
+        }
+        return Boolean::of(false);
+    }
+
+    Ref<String> prefix = stringArgument(params, 0, "startswith");
+    if (!prefix) {
+        throw std::runtime_error("startswith: Argument must be a string or tuple of strings");
+    }
+    return Boolean::of(window.starts_with(prefix->view()));
+}
+
+String::Method::result_type String::endswith(Args params) {
+    if (params.size() < 1 || params.size() > 3) {
+      throw std::runtime_error("endswith: Invalid number of arguments");
+    }
+
+    std::size_t offset = 0;
+    std::string_view window;
+    if (!searchWindow(*this, params, 1, offset, window)) {
+        return Boolean::of(false);
+    }
+
+    // A tuple matches when any of its suffixes does
+    if (params[0] && params[0]->type() == TypeTag::Tuple) {
+        for (const var& suffix : static_cast<const Tuple&>(*params[0]).getValue()) {
+            auto string = objectCast<String>(suffix.getValue());
+            if (!string) {
+                throw std::runtime_error("endswith: Tuple items must be strings");
+            }
+            if (window.ends_with(string->view())) {
+                return Boolean::of(true);
+            }
+        }
+        return Boolean::of(false);
+    }
+
+    Ref<String> suffix = stringArgument(params, 0, "endswith");
+    if (!suffix) {
+        throw std::runtime_error("endswith: Argument must be a string or tuple of strings");
+    }
+    return Boolean::of(window.ends_with(suffix->view()));
+}
+
+String::Method::result_type String::strip(Args params) {
+    if (params.size() > 1) {
+      throw std::runtime_error("strip: Invalid number of arguments");
+    }
+
+    // Whitespace unless a set of characters is given
+    Ref<String> characters = stringArgument(params, 0, "strip");
+    auto stripped = [&characters](std::string_view character) {
+        return characters ? characters->view().find(character) != std::string_view::npos
+                          : StringKernels::isSpace(character[0]);
+    };
+
+    // Multi-byte characters are stripped whole, and only when given
+    unpin();
+    std::string_view text = view();
+    const bool utf8 = !indexesBytes() && characters && !characters->indexesBytes();
+    std::size_t start = 0;
+    std::size_t end = text.size();
+    while (start < end) {
+        std::size_t length = utf8 ? StringKernels::sequenceLength(text[start]) : 1;
+        if (!stripped(text.substr(start, length))) {
+            break;
+        }
+        start += length;
+    }
+    while (end > start) {
+        std::size_t length = 1;
+        while (utf8 && length < end - start && (static_cast<unsigned char>(text[end - length]) & 0xC0) == 0x80) {
+            ++length;
+        }
+        if (!stripped(text.substr(end - length, length))) {
+            break;
+        }
+        end -= length;
+    }
+
+    return substring(start, end - start);
+}
+
+String::Method::result_type String::upper(Args params) {
+    if (params.size() != 0) {
+      throw std::runtime_error("upper: Invalid number of arguments");
+    }
+
+    return makeRef<String>(StringKernels::upper(view()));
+}
+
+String::Method::result_type String::lower(Args params) {
+    if (params.size() != 0) {
+      throw std::runtime_error("lower: Invalid number of arguments");
+    }
+
+    return makeRef<String>(StringKernels::lower(view()));
+}
+
+String::Method::result_type String::len(Args params) {
     if (params.size() != 0) {
       throw std::runtime_error("__len__: Invalid number of arguments");
     }
 
-    return std::make_shared<Integer>(this->value.length());
+    return Integer::of(characterCount());
 }
 
-String::Method::result_type String::asBool(const std::vector<ObjectPtr>& params) {
+String::Method::result_type String::asBool(Args params) {
     if (params.size() != 0) {
       throw std::runtime_error("__bool__: Invalid number of arguments");
     }
 
-    return std::make_shared<Boolean>(this->value.length() > 0);
+    return Boolean::of(!view().empty());
 }
 
-String::Method::result_type String::asString(const std::vector<ObjectPtr>& params) {
+String::Method::result_type String::asString(Args params) {
     if (params.size() != 0) {
       throw std::runtime_error("__str__: Invalid number of arguments");
     }
 
-    return std::make_shared<String>(*this);
-}
\ No newline at end of file
+    return makeRef<String>(*this);
+}
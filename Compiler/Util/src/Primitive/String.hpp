@@ -1,21 +1,140 @@
 // Copyright (c) 2024 Syntax Errors.
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "./Primitive.hpp"            // NOLINT
 
-// String class
+// String class. Slices and split pieces may be views into the bytes of the
+// string they were cut from, which then stays alive as their base.
+// Contents are UTF-8: indexing, slicing, len and iteration count code points.
+// ASCII strings, and bytes that are not valid UTF-8, index one byte per character
 class String : public Primitive<String, std::string> {
 	private:
 		using Primitive::value;
 
-		void init();
+		// Pieces shorter than this fit in std::string's inline buffer, so
+		// copying them is cheaper than keeping a view
+		static constexpr std::size_t minimumViewLength = 16;
+
+		// A view covering less than 1/pinRatio of its base copies its bytes out
+		// once it is the only thing keeping the base alive
+		static constexpr std::size_t pinRatio = 4;
+
+		// Strings are immutable, so their hash is only computed once
+		HashCache _hash;
+
+		// Whether this is the one shared string with its contents (see intern)
+		bool interned = false;
+
+		enum class Encoding : uint8_t { Unknown, Ascii, Utf8, Invalid };
+
+		// Found by scanning the contents once, on first use
+		mutable Encoding _encoding = Encoding::Unknown;
+
+		// Owning string holding the contents of a view, null when `value` holds them
+		mutable Ref<String> _base;
+		mutable std::size_t _offset = 0;
+		mutable std::size_t _length = 0;
+
+		// Code points between entries of the code point index
+		static constexpr std::size_t indexStride = 64;
+
+		// Characters of a string with multi-byte ones, and the byte offset of
+		// every indexStride-th of them once it is first indexed
+		struct Utf8Index {
+			std::size_t characters;
+			std::vector<std::size_t> offsets;
+		};
+		mutable std::unique_ptr<Utf8Index> _utf8;
+
+		// Fill in the encoding and number of characters
+		void scan() const;
+
+		// Offsets of the code point index, built on first use
+		const std::vector<std::size_t>& characterOffsets() const;
+
+		// Copy the contents of a view into `value` and drop its base
+		void materialize() const;
+
+		// Materialize a small view that alone keeps its base alive. Must run
+		// before taking a view() that is used across calls
+		void unpin() const;
+
+		// Characters [start, start + length) of view(), as a view when worthwhile
+		ObjectPtr substring(std::size_t start, std::size_t length) const;
 
  	public:
+		static constexpr TypeTag tag = TypeTag::String;
+
 		explicit String(std::string value);
+
+		// Copies are never interned, even when the original is
+		String(const String& other);
+
 		operator ObjectPtr();
 
+		// Shared immortal string holding a single character
+		static ObjectPtr of(char character);
+
+		// String holding one UTF-8 encoded character, shared when it is ASCII
+		static ObjectPtr of(std::string_view character);
+
+		// Shared immortal string with the given contents, created on first use.
+		// Interned strings compare by address against each other
+		static ObjectPtr intern(std::string_view text);
+
+		inline bool isInterned() const { return interned; }
+
+		// Whether every byte is one character: ASCII, or not valid UTF-8
+		inline bool indexesBytes() const {
+			if (_encoding == Encoding::Unknown) {
+				scan();
+			}
+			return _encoding != Encoding::Utf8;
+		}
+
+		inline bool isAscii() const {
+			return indexesBytes() && _encoding == Encoding::Ascii;
+		}
+
+		// Number of characters, which is the number of bytes unless some are multi-byte
+		inline std::size_t characterCount() const {
+			return indexesBytes() ? view().size() : _utf8->characters;
+		}
+
+		// Byte offset where a character starts, the size of view() past the last one
+		std::size_t byteOffset(std::size_t character) const;
+
+		// Character starting at a byte offset of view()
+		std::size_t characterIndex(std::size_t offset) const;
+
+		// Contents, without copying a view
+		inline std::string_view view() const {
+			return _base ? std::string_view(_base->value.data() + _offset, _length) : std::string_view(value);
+		}
+
+		// Contents as an owned std::string, copied out first for a view
+		inline const std::string& getValue() const {
+			if (_base) {
+				materialize();
+			}
+			return value;
+		}
+
+		// String whose bytes view() points into, kept alive by the caller
+		Ref<String> buffer() const;
+
+		void print(std::ostream& os) const override;
+
+		ObjectPtr clone() const override;
+
 		ObjectPtr add(const Object& other) const override;
 
 		ObjectPtr subscript(const Object& other) const override;
@@ -30,14 +149,25 @@ class String : public Primitive<String, std::string> {
 
 		explicit operator bool() const override;
 
+		std::size_t hash() const override;
+
+		std::partial_ordering compare(const Object& other) const override;
+
+		bool equals(const Object& other) const override;
+
+		// Grow in place, only for a string no one else holds (see var::operator+=)
+		void append(const String& other);
+
 		// Override iteration methods
 		class StringIterator : public Object::ObjectIterator {
 			private:
-				const std::string& str;
+				Ref<String> owner;
+				std::string_view str;
 				size_t currentIndex;
+				bool utf8;
 
 			public:
-				explicit StringIterator(const std::string& str);
+				explicit StringIterator(const String& string);
 
 				bool hasNext() const override;
 
@@ -48,8 +178,39 @@ class String : public Primitive<String, std::string> {
 
 		ObjectIt getIterator() const override;
 
-		Method::result_type slice(const std::vector<ObjectPtr>& params);
-		Method::result_type len(const std::vector<ObjectPtr>& params);
-		Method::result_type asBool(const std::vector<ObjectPtr>& params);
-		Method::result_type asString(const std::vector<ObjectPtr>& params);
+		const MethodTable& getMethods() const override;
+
+		Method::result_type slice(Args params);
+		Method::result_type join(Args params);
+		Method::result_type split(Args params);
+		Method::result_type find(Args params);
+		Method::result_type rfind(Args params);
+		Method::result_type count(Args params);
+		Method::result_type replace(Args params);
+		Method::result_type startswith(Args params);
+		Method::result_type endswith(Args params);
+		Method::result_type strip(Args params);
+		Method::result_type upper(Args params);
+		Method::result_type lower(Args params);
+		Method::result_type len(Args params);
+		Method::result_type asBool(Args params);
+		Method::result_type asString(Args params);
 };
+
+// Characters of a string literal, usable as a template argument
+template <std::size_t Size>
+struct StringLiteral {
+	char text[Size];
+
+	constexpr StringLiteral(const char (&literal)[Size]) { std::copy_n(literal, Size, text); }
+
+	constexpr std::string_view view() const { return std::string_view(text, Size - 1); }
+};
+
+// String literal emitted by the generator as "text"_interned. Each distinct
+// literal is looked up in the intern table once, later uses share it
+template <StringLiteral Literal>
+inline ObjectPtr operator""_interned() {
+	static const ObjectPtr interned = String::intern(Literal.view());
+	return interned;
+}
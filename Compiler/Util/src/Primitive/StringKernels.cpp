@@ -0,0 +1,318 @@
+// Copyright (c) 2024 Syntax Errors.
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "./StringKernels.hpp"
+
+namespace {
+    // Bytes compared per step by the vector kernels
+#if defined(__AVX2__)
+    constexpr std::size_t blockSize = 32;
+    using Block = __m256i;
+
+    inline Block load(const char* data) { return _mm256_loadu_si256(reinterpret_cast<const Block*>(data)); }
+    inline void store(char* data, Block block) { _mm256_storeu_si256(reinterpret_cast<Block*>(data), block); }
+    inline Block broadcast(char byte) { return _mm256_set1_epi8(byte); }
+    inline Block equal(Block lhs, Block rhs) { return _mm256_cmpeq_epi8(lhs, rhs); }
+    inline Block greater(Block lhs, Block rhs) { return _mm256_cmpgt_epi8(lhs, rhs); }
+    inline Block both(Block lhs, Block rhs) { return _mm256_and_si256(lhs, rhs); }
+    inline Block flip(Block lhs, Block rhs) { return _mm256_xor_si256(lhs, rhs); }
+    inline uint32_t mask(Block block) { return static_cast<uint32_t>(_mm256_movemask_epi8(block)); }
+#elif defined(__SSE2__)
+    constexpr std::size_t blockSize = 16;
+    using Block = __m128i;
+
+    inline Block load(const char* data) { return _mm_loadu_si128(reinterpret_cast<const Block*>(data)); }
+    inline void store(char* data, Block block) { _mm_storeu_si128(reinterpret_cast<Block*>(data), block); }
+    inline Block broadcast(char byte) { return _mm_set1_epi8(byte); }
+    inline Block equal(Block lhs, Block rhs) { return _mm_cmpeq_epi8(lhs, rhs); }
+    inline Block greater(Block lhs, Block rhs) { return _mm_cmpgt_epi8(lhs, rhs); }
+    inline Block both(Block lhs, Block rhs) { return _mm_and_si128(lhs, rhs); }
+    inline Block flip(Block lhs, Block rhs) { return _mm_xor_si128(lhs, rhs); }
+    inline uint32_t mask(Block block) { return static_cast<uint32_t>(_mm_movemask_epi8(block)); }
+#endif
+
+    // Whether the pattern occurs at `position`, given its first and last bytes already match
+    inline bool matchesInside(const char* position, std::string_view pattern) {
+        return pattern.size() <= 2 || std::memcmp(position + 1, pattern.data() + 1, pattern.size() - 2) == 0;
+    }
+
+    // Flip the case of ASCII letters between `low` and `high`
+    inline void mapCase(std::string& text, char low, char high) {
+        std::size_t index = 0;
+#if defined(__AVX2__) || defined(__SSE2__)
+        // Signed compares leave bytes past ASCII out of the range
+        const Block below = broadcast(static_cast<char>(low - 1));
+        const Block above = broadcast(static_cast<char>(high + 1));
+        const Block caseBit = broadcast(0x20);
+        for (; index + blockSize <= text.size(); index += blockSize) {
+            Block block = load(text.data() + index);
+            Block letters = both(greater(block, below), greater(above, block));
+            store(text.data() + index, flip(block, both(letters, caseBit)));
+        }
+#endif
+        for (; index < text.size(); ++index) {
+            if (text[index] >= low && text[index] <= high) {
+                text[index] ^= 0x20;
+            }
+        }
+    }
+}
+
+namespace StringKernels {
+    std::size_t find(std::string_view text, std::string_view pattern, std::size_t from) {
+        const std::size_t size = text.size();
+        const std::size_t length = pattern.size();
+        if (from > size || length > size - from) {
+            return npos;
+        }
+        if (length == 0) {
+            return from;
+        }
+
+        const char* data = text.data();
+        if (length == 1) {
+            const void* match = std::memchr(data + from, pattern[0], size - from);
+            return match ? static_cast<const char*>(match) - data : npos;
+        }
+
+        // Skip to the next occurrence of the first byte with memchr, which is
+        // fastest when it is rare. From there, candidates are the positions
+        // whose first and last bytes both match, checked a block at a time,
+        // which keeps frequent first bytes from stalling the search
+        std::size_t position = from;
+#if defined(__AVX2__) || defined(__SSE2__)
+        const Block first = broadcast(pattern[0]);
+        const Block last = broadcast(pattern[length - 1]);
+        while (position + length - 1 + blockSize <= size) {
+            const void* next = std::memchr(data + position, pattern[0], size - length + 1 - position);
+            if (!next) {
+                return npos;
+            }
+            position = static_cast<const char*>(next) - data;
+            if (position + length - 1 + blockSize > size) {
+                break;
+            }
+
+            uint32_t candidates = mask(both(
+                equal(first, load(data + position)),
+                equal(last, load(data + position + length - 1))));
+
+            for (; candidates; candidates &= candidates - 1) {
+                const std::size_t match = position + std::countr_zero(candidates);
+                if (matchesInside(data + match, pattern)) {
+                    return match;
+                }
+            }
+            position += blockSize;
+        }
+#endif
+        for (; position + length <= size; ++position) {
+            if (data[position] == pattern[0] && data[position + length - 1] == pattern[length - 1]
+                && matchesInside(data + position, pattern)) {
+                return position;
+            }
+        }
+        return npos;
+    }
+
+    std::size_t rfind(std::string_view text, std::string_view pattern, std::size_t from) {
+        const std::size_t size = text.size();
+        const std::size_t length = pattern.size();
+        if (length > size) {
+            return npos;
+        }
+
+        // Candidates are the positions before `end`
+        std::size_t end = std::min(from, size - length) + 1;
+        if (length == 0) {
+            return end - 1;
+        }
+
+        const char* data = text.data();
+#if defined(__AVX2__) || defined(__SSE2__)
+        if (length > 1) {
+            const Block first = broadcast(pattern[0]);
+            const Block last = broadcast(pattern[length - 1]);
+            for (; end >= blockSize; end -= blockSize) {
+                const std::size_t position = end - blockSize;
+                uint32_t candidates = mask(both(
+                    equal(first, load(data + position)),
+                    equal(last, load(data + position + length - 1))));
+
+                // Latest candidates first
+                while (candidates) {
+                    const int offset = 31 - std::countl_zero(candidates);
+                    if (matchesInside(data + position + offset, pattern)) {
+                        return position + offset;
+                    }
+                    candidates &= ~(1u << offset);
+                }
+            }
+        }
+#endif
+        while (end > 0) {
+            --end;
+            if (data[end] == pattern[0] && data[end + length - 1] == pattern[length - 1]
+                && matchesInside(data + end, pattern)) {
+                return end;
+            }
+        }
+        return npos;
+    }
+
+    std::size_t count(std::string_view text, std::string_view pattern) {
+        if (pattern.empty()) {
+            return text.size() + 1;
+        }
+
+        std::size_t total = 0;
+        if (pattern.size() == 1) {
+            std::size_t index = 0;
+#if defined(__AVX2__) || defined(__SSE2__)
+            const Block byte = broadcast(pattern[0]);
+            for (; index + blockSize <= text.size(); index += blockSize) {
+                total += std::popcount(mask(equal(byte, load(text.data() + index))));
+            }
+#endif
+            for (; index < text.size(); ++index) {
+                total += text[index] == pattern[0];
+            }
+            return total;
+        }
+
+        for (std::size_t match = find(text, pattern); match != npos; match = find(text, pattern, match + pattern.size())) {
+            ++total;
+        }
+        return total;
+    }
+
+    std::string replace(std::string_view text, std::string_view pattern, std::string_view replacement, int limit) {
+        std::string result;
+        std::size_t replaced = 0;
+        auto allowed = [&]() { return limit < 0 || replaced < static_cast<std::size_t>(limit); };
+
+        // An empty pattern matches before every byte and at the end
+        if (pattern.empty()) {
+            result.reserve(text.size() + replacement.size() * (text.size() + 1));
+            for (std::size_t index = 0; index <= text.size(); ++index) {
+                if (allowed()) {
+                    result.append(replacement);
+                    ++replaced;
+                }
+                if (index < text.size()) {
+                    result.push_back(text[index]);
+                }
+            }
+            return result;
+        }
+
+        result.reserve(text.size());
+        std::size_t start = 0;
+        for (std::size_t match = find(text, pattern); match != npos && allowed(); match = find(text, pattern, start)) {
+            result.append(text.substr(start, match - start));
+            result.append(replacement);
+            start = match + pattern.size();
+            ++replaced;
+        }
+        result.append(text.substr(start));
+        return result;
+    }
+
+    Utf8Scan scanUtf8(std::string_view text) {
+        const char* data = text.data();
+        const std::size_t size = text.size();
+        std::size_t index = 0;
+        std::size_t characters = 0;
+        bool ascii = true;
+
+        while (index < size) {
+#if defined(__AVX2__) || defined(__SSE2__)
+            while (index + blockSize <= size && mask(load(data + index)) == 0) {
+                index += blockSize;
+                characters += blockSize;
+            }
+            if (index == size) {
+                break;
+            }
+#endif
+            const unsigned char lead = static_cast<unsigned char>(data[index]);
+            if (lead < 0x80) {
+                ++index;
+                ++characters;
+                continue;
+            }
+            ascii = false;
+
+            // Sequence length, payload bits of the lead byte and smallest
+            // code point that needs this many bytes
+            std::size_t length;
+            uint32_t codePoint;
+            uint32_t minimum;
+            if ((lead & 0xE0) == 0xC0) {
+                length = 2, codePoint = lead & 0x1F, minimum = 0x80;
+            } else if ((lead & 0xF0) == 0xE0) {
+                length = 3, codePoint = lead & 0x0F, minimum = 0x800;
+            } else if ((lead & 0xF8) == 0xF0) {
+                length = 4, codePoint = lead & 0x07, minimum = 0x10000;
+            } else {
+                return {false, false, 0};
+            }
+
+            if (length > size - index) {
+                return {false, false, 0};
+            }
+            for (std::size_t offset = 1; offset < length; ++offset) {
+                const unsigned char byte = static_cast<unsigned char>(data[index + offset]);
+                if ((byte & 0xC0) != 0x80) {
+                    return {false, false, 0};
+                }
+                codePoint = (codePoint << 6) | (byte & 0x3F);
+            }
+
+            // Overlong forms, surrogates and values past Unicode
+            if (codePoint < minimum || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF)) {
+                return {false, false, 0};
+            }
+
+            index += length;
+            ++characters;
+        }
+
+        return {ascii, true, characters};
+    }
+
+    std::size_t countCharacters(std::string_view text) {
+        std::size_t total = 0;
+        std::size_t index = 0;
+#if defined(__AVX2__) || defined(__SSE2__)
+        // Signed, continuation bytes 0x80-0xBF are the ones at or below 0xBF
+        const Block continuation = broadcast(static_cast<char>(0xBF));
+        for (; index + blockSize <= text.size(); index += blockSize) {
+            total += std::popcount(mask(greater(load(text.data() + index), continuation)));
+        }
+#endif
+        for (; index < text.size(); ++index) {
+            total += (static_cast<unsigned char>(text[index]) & 0xC0) != 0x80;
+        }
+        return total;
+    }
+
+    std::string upper(std::string_view text) {
+        std::string result(text);
+        mapCase(result, 'a', 'z');
+        return result;
+    }
+
+    std::string lower(std::string_view text) {
+        std::string result(text);
+        mapCase(result, 'A', 'Z');
+        return result;
+    }
+}
@@ -0,0 +1,54 @@
+// Copyright (c) 2024 Syntax Errors.
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Byte-level search and case mapping behind the String methods. Kernels use
+// AVX2 or SSE2 when the target has them and plain loops otherwise
+namespace StringKernels {
+    constexpr std::size_t npos = std::string_view::npos;
+
+    // First position at or after `from` where `pattern` starts, or npos
+    std::size_t find(std::string_view text, std::string_view pattern, std::size_t from = 0);
+
+    // Last position at or before `from` where `pattern` starts, or npos
+    std::size_t rfind(std::string_view text, std::string_view pattern, std::size_t from = npos);
+
+    // Non-overlapping occurrences of `pattern`, empty patterns match between every byte
+    std::size_t count(std::string_view text, std::string_view pattern);
+
+    // Copy of `text` with up to `limit` occurrences of `pattern` replaced, all if negative
+    std::string replace(std::string_view text, std::string_view pattern, std::string_view replacement, int limit = -1);
+
+    // Copy of `text` with ASCII letters mapped to upper or lower case
+    std::string upper(std::string_view text);
+    std::string lower(std::string_view text);
+
+    // Whether a byte is ASCII whitespace, like str.isspace for ASCII text
+    inline bool isSpace(char character) {
+        return character == ' ' || (character >= '\t' && character <= '\r');
+    }
+
+    // Encoding of a run of bytes, as found by scanUtf8
+    struct Utf8Scan {
+        bool ascii;
+        bool valid;
+        // Code points, when valid
+        std::size_t characters;
+    };
+
+    // Check that `text` is valid UTF-8 and count its code points, skipping
+    // over runs of ASCII a block at a time
+    Utf8Scan scanUtf8(std::string_view text);
+
+    // Code points in valid UTF-8, counting the bytes that start one
+    std::size_t countCharacters(std::string_view text);
+
+    // Bytes in the UTF-8 sequence starting with `lead`
+    inline std::size_t sequenceLength(char lead) {
+        const unsigned char byte = static_cast<unsigned char>(lead);
+        return byte < 0xC0 ? 1 : byte < 0xE0 ? 2 : byte < 0xF0 ? 3 : 4;
+    }
+}
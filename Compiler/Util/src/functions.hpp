@@ -10,7 +10,7 @@
 // Helper to safely extract a value or use a default
 template <typename T>
 T getValueOrDefault(const ObjectPtr& obj, const T& defaultValue) {
-  if (auto ptr = dynamic_cast<const T*>(&*obj)) {
+  if (auto ptr = objectCast<T>(&*obj)) {
     return *ptr;
   }
   return defaultValue;
@@ -24,12 +24,14 @@ void assignValues(Tuple& values, Iterator& it, Iterator end) {  // NOLINT
   }, values);
 }
 
-template <typename Container, typename AddElementFn, typename ResultFactoryFn>
-ObjectPtr generalizedSlice(
-  const Container& container,
-  std::vector<ObjectPtr> params,
-  AddElementFn addElementFn,
-  ResultFactoryFn resultFactoryFn) {
+// Normalized positions of a slice over a container of a given size
+struct SliceBounds {
+  size_t start;
+  size_t end;
+  int step;
+};
+
+inline SliceBounds sliceBounds(size_t containerSize, Args params) {
   // Default values for start, end, and step
   std::tuple<Integer, Integer, Integer> values = {Integer(0), Integer(-1), Integer(1)};
   auto it = params.begin();
@@ -43,8 +45,6 @@ ObjectPtr generalizedSlice(
     throw std::invalid_argument("Step cannot be zero");
   }
 
-  size_t containerSize = container.size();
-
   // Normalize start and end indices
   auto normalizeIndex = [containerSize](int index) -> size_t {
     if (index < 0) {
@@ -56,18 +56,30 @@ ObjectPtr generalizedSlice(
   size_t normalizedStart = normalizeIndex(start);
   size_t normalizedEnd = normalizeIndex(end);
 
+  if (step < 0 && normalizedStart < normalizedEnd) {
+    throw std::invalid_argument("For negative step, start must be greater than end.");
+  }
+
+  return {normalizedStart, normalizedEnd, step};
+}
+
+template <typename Container, typename AddElementFn, typename ResultFactoryFn>
+ObjectPtr generalizedSlice(
+  const Container& container,
+  Args params,
+  AddElementFn addElementFn,
+  ResultFactoryFn resultFactoryFn) {
+  SliceBounds bounds = sliceBounds(container.size(), params);
+
   // Create a new container for the result
   Container resultContainer;
 
-  if (step > 0) {
-    for (size_t i = normalizedStart; i < normalizedEnd; i += step) {
+  if (bounds.step > 0) {
+    for (size_t i = bounds.start; i < bounds.end; i += bounds.step) {
       addElementFn(resultContainer, container[i]);
     }
   } else {
-    if (normalizedStart < normalizedEnd) {
-      throw std::invalid_argument("For negative step, start must be greater than end.");
-    }
-    for (int i = static_cast<int>(normalizedStart); i >= static_cast<int>(normalizedEnd); i += step) {
+    for (int i = static_cast<int>(bounds.start); i >= static_cast<int>(bounds.end); i += bounds.step) {
       addElementFn(resultContainer, container[i]);
     }
   }
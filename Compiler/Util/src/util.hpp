@@ -8,6 +8,7 @@
 #include "./Object/object.hpp"
 #include "./Primitive/Boolean.hpp"
 #include "./Primitive/String.hpp"
+#include "./Primitive/Builtin.hpp"
 #include "./Numeric/Numeric.hpp"
 #include "./Numeric/Integer.hpp"
 #include "./Numeric/Double.hpp"
@@ -17,4 +18,5 @@
 #include "./Collections/Map.hpp"
 #include "./Collections/Set.hpp"
 #include "./Collections/Pair.hpp"
-#include "./Collections/Builtin.hpp"
\ No newline at end of file
+#include "./Collections/Builtin.hpp"
+#include "./Collections/Cursor.hpp"
\ No newline at end of file
@@ -0,0 +1,26 @@
+// Copyright (c) 2024 Syntax Errors.
+#pragma once
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// Minimal checks for the runtime tests. A failed check is reported and the
+// test goes on, main returns the number of failures
+inline int failures = 0;
+
+#define CHECK(condition)                                                    \
+  do {                                                                      \
+    if (!(condition)) {                                                     \
+      std::cerr << __FILE__ << ":" << __LINE__ << ": " #condition "\n";   \
+      ++failures;                                                           \
+    }                                                                       \
+  } while (false)
+
+// Printed form of a value, as the generated program would output it
+template <typename T>
+std::string printed(const T& value) {
+  std::ostringstream os;
+  os << value;
+  return os.str();
+}
@@ -0,0 +1,124 @@
+// Copyright (c) 2024 Syntax Errors.
+#include <stdexcept>
+#include <string>
+
+#include "./check.hpp"
+#include "util.hpp"
+
+// Loops over built-in containers, and containers changing while they loop
+
+namespace {
+  // Message of the error a loop over `iterable` raises while `body` runs, if any
+  template <typename Body>
+  std::string loopError(var& iterable, Body body) {
+    try {
+      for (auto element : iterable) {
+        body(element);
+      }
+    } catch (const std::runtime_error& error) {
+      return error.what();
+    }
+    return "";
+  }
+
+  void setChangedDuringLoop() {
+    var set = Builtin::inlineSet({var(1), var(2), var(3)});
+    CHECK(loopError(set, [&](const var& element) { set.Call(Methods::remove, {element.getValue()}); })
+        == "Set changed size during iteration");
+
+    set = Builtin::inlineSet({var(1), var(2), var(3)});
+    CHECK(loopError(set, [&](const var&) { set.Call(Methods::clear, {}); }) == "Set changed size during iteration");
+
+    set = Builtin::inlineSet({var(1)});
+    CHECK(loopError(set, [&](const var& element) { set.Call(Methods::add, {var(element + var(1)).getValue()}); })
+        == "Set changed size during iteration");
+  }
+
+  // Another variable holding the set keeps it, the loop goes on over the
+  // elements it started with
+  void sharedSetChangedDuringLoop() {
+    var set = Builtin::inlineSet({var(1), var(2), var(3)});
+    var copy = set;
+    CHECK(loopError(set, [&](const var& element) { set.Call(Methods::remove, {element.getValue()}); }).empty());
+    CHECK(Builtin::len({set}) == var(0));
+    CHECK(Builtin::len({copy}) == var(3));
+  }
+
+  void setReboundDuringLoop() {
+    var set = Builtin::inlineSet({var(1), var(2), var(3)});
+    var total = 0;
+    CHECK(loopError(set, [&](const var& element) {
+      set = Builtin::inlineSet({});
+      total = total + element;
+    }).empty());
+    CHECK(total == var(6));
+  }
+
+  void setChangedThroughSlot() {
+    var outer = Builtin::inlineList({});
+    outer.Call(Methods::append, {Builtin::inlineSet({var(1), var(2), var(3)}).getValue()});
+
+    // The loop walks a copy of the element, so the slot takes one of its own
+    std::size_t visited = 0;
+    for (auto element : var(outer[var(0)])) {
+      outer[var(0)].Call(Methods::clear, {});
+      CHECK(element.getKind() == var::Kind::Integer);
+      ++visited;
+    }
+    CHECK(visited == 3);
+    CHECK(Builtin::len({var(outer[var(0)])}) == var(0));
+  }
+
+  void setUnchangedDuringLoop() {
+    var set = Builtin::inlineSet({var(1), var(2), var(3)});
+    var total = 0;
+    CHECK(loopError(set, [&](const var& element) { total = total + element; }).empty());
+    CHECK(total == var(6));
+  }
+
+  void mapChangedDuringLoop() {
+    var map = Builtin::inlineDict({Pair(var("a"), var(1)), Pair(var("b"), var(2))});
+    CHECK(loopError(map, [&](const var&) { map.Call(Methods::addElement, {var("c").getValue(), var(3).getValue()}); })
+        == "Map changed size during iteration");
+  }
+
+  void mapViews() {
+    var map = Builtin::inlineDict({Pair(var("a"), var(1)), Pair(var("b"), var(2))});
+    var keys = map.Call(Methods::keys, {});
+    var values = map.Call(Methods::values, {});
+    var items = map.Call(Methods::items, {});
+
+    std::string visited;
+    for (auto key : keys) {
+      visited += printed(key);
+    }
+    var total = 0;
+    for (auto value : values) {
+      total = total + value;
+    }
+    CHECK(visited == "ab");
+    CHECK(total == var(3));
+    CHECK(printed(keys) == "[a, b]");
+    CHECK(printed(Builtin::list({items})) == printed(Builtin::inlineList({var(Pair(var("a"), var(1))), var(Pair(var("b"), var(2)))})));
+    CHECK(var(keys.Call(Methods::has, {var("b").getValue()})));
+    CHECK(!var(values.Call(Methods::has, {var("b").getValue()})));
+    CHECK(Builtin::len({values}) == var(2));
+    CHECK(Builtin::sum({values}) == var(3));
+
+    // Views share the map like any copy, a change to the map leaves them as they were
+    map.Call(Methods::addElement, {var("c").getValue(), var(3).getValue()});
+    CHECK(printed(keys) == "[a, b]");
+    CHECK(printed(var(map.Call(Methods::keys, {}))) == "[a, b, c]");
+  }
+}
+
+int main() {
+  setChangedDuringLoop();
+  sharedSetChangedDuringLoop();
+  setReboundDuringLoop();
+  setChangedThroughSlot();
+  setUnchangedDuringLoop();
+  mapChangedDuringLoop();
+  mapViews();
+  return failures;
+}
@@ -0,0 +1,150 @@
+// Copyright (c) 2024 Syntax Errors.
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "./check.hpp"
+#include "util.hpp"
+
+// Dict under insert/erase/reinsert churn keeps the same entries, in the same
+// order, as a plain insertion-ordered model of it
+
+namespace {
+  std::mt19937 generator(12);
+
+  // Keys in insertion order with their values, updated the way Python dicts are
+  struct Model {
+    std::vector<std::pair<int32_t, int32_t>> entries;
+
+    auto find(int32_t key) {
+      return std::find_if(entries.begin(), entries.end(), [key](const auto& entry) { return entry.first == key; });
+    }
+  };
+
+  void checkSame(const Dict& dict, const Model& model) {
+    CHECK(dict.size() == model.entries.size());
+
+    auto expected = model.entries.begin();
+    for (const Dict::Entry& entry : dict) {
+      if (expected == model.entries.end()) {
+        CHECK(false);
+        return;
+      }
+      CHECK(entry.first == var(expected->first));
+      CHECK(entry.second == var(expected->second));
+      ++expected;
+    }
+    CHECK(expected == model.entries.end());
+
+    for (const auto& [key, value] : model.entries) {
+      auto match = dict.find(var(key));
+      CHECK(match != dict.end() && match->second == var(value));
+    }
+  }
+
+  // Few keys, so erased ones come back and removed slots get reused
+  void churn(int32_t keys, std::size_t steps) {
+    std::uniform_int_distribution<int32_t> key(0, keys - 1);
+    std::uniform_int_distribution<int> operation(0, 99);
+
+    Dict dict;
+    Model model;
+    for (std::size_t step = 0; step < steps; ++step) {
+      const int32_t chosen = key(generator);
+      const int choice = operation(generator);
+
+      if (choice < 50) {
+        // New keys go last, existing ones keep their place
+        dict[var(chosen)] = var(static_cast<int32_t>(step));
+        auto match = model.find(chosen);
+        if (match != model.entries.end()) {
+          match->second = static_cast<int32_t>(step);
+        } else {
+          model.entries.emplace_back(chosen, static_cast<int32_t>(step));
+        }
+      } else if (choice < 99) {
+        auto position = dict.find(var(chosen));
+        auto match = model.find(chosen);
+        CHECK((position != dict.end()) == (match != model.entries.end()));
+        if (position != dict.end()) {
+          dict.erase(position);
+          model.entries.erase(match);
+        }
+      } else {
+        dict.clear();
+        model.entries.clear();
+      }
+
+      if (step % 64 == 0) {
+        checkSame(dict, model);
+      }
+    }
+    checkSame(dict, model);
+  }
+
+  void insertReportsNewKeys() {
+    Dict dict;
+    CHECK(dict.insert(var("a"), var(1)).second);
+    CHECK(!dict.insert(var("a"), var(2)).second);
+    CHECK(dict.find(var("a"))->second == var(1));
+
+    dict.erase(dict.find(var("a")));
+    CHECK(dict.empty());
+    CHECK(dict.insert(var("a"), var(3)).second);
+    CHECK(dict.size() == 1);
+  }
+
+  // Erasing everything but the last key, again and again, leaves only holes
+  // for the next resize to drop
+  void reinsertAfterErasingAll() {
+    Dict dict;
+    for (int32_t round = 0; round < 200; ++round) {
+      for (int32_t key = 0; key < 10; ++key) {
+        dict[var(key)] = var(round);
+      }
+      for (int32_t key = 0; key < 9; ++key) {
+        dict.erase(dict.find(var(key)));
+      }
+    }
+    CHECK(dict.size() == 1);
+    CHECK(dict.begin()->first == var(9));
+    CHECK(dict.begin()->second == var(199));
+  }
+
+  void stringKeys() {
+    Dict dict;
+    for (int32_t key = 0; key < 300; ++key) {
+      dict[var(std::to_string(key))] = var(key);
+    }
+    for (int32_t key = 0; key < 300; key += 2) {
+      dict.erase(dict.find(var(std::to_string(key))));
+    }
+    for (int32_t key = 0; key < 300; key += 4) {
+      dict[var(std::to_string(key))] = var(-key);
+    }
+
+    std::vector<std::string> order;
+    for (const Dict::Entry& entry : dict) {
+      order.push_back(printed(entry.first));
+    }
+    CHECK(order.size() == 225);
+    CHECK(order.front() == "1");
+    CHECK(order[149] == "299");
+    CHECK(order[150] == "0");
+    CHECK(order.back() == "296");
+    CHECK(dict.find(var("4"))->second == var(-4));
+    CHECK(dict.find(var("2")) == dict.end());
+  }
+}
+
+int main() {
+  churn(8, 5000);
+  churn(64, 20000);
+  churn(1000, 20000);
+  insertReportsNewKeys();
+  reinsertAfterErasingAll();
+  stringKeys();
+  return failures;
+}
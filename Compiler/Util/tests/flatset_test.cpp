@@ -0,0 +1,118 @@
+// Copyright (c) 2024 Syntax Errors.
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_set>
+
+#include "./check.hpp"
+#include "util.hpp"
+
+// FlatSet under insert/erase/reinsert churn holds the same elements as
+// std::unordered_set, however many tombstones and rehashes it went through
+
+namespace {
+  std::mt19937 generator(13);
+
+  void checkSame(const FlatSet<var>& set, const std::unordered_set<int32_t>& model) {
+    CHECK(set.size() == model.size());
+    CHECK(set.empty() == model.empty());
+
+    std::size_t visited = 0;
+    for (const var& element : set) {
+      CHECK(model.count(std::stoi(printed(element))) == 1);
+      ++visited;
+    }
+    CHECK(visited == model.size());
+
+    for (int32_t element : model) {
+      CHECK(set.contains(var(element)));
+    }
+  }
+
+  void churn(int32_t values, std::size_t steps) {
+    std::uniform_int_distribution<int32_t> value(0, values - 1);
+    std::uniform_int_distribution<int> operation(0, 99);
+
+    FlatSet<var> set;
+    std::unordered_set<int32_t> model;
+    for (std::size_t step = 0; step < steps; ++step) {
+      const int32_t chosen = value(generator);
+      const int choice = operation(generator);
+
+      if (choice < 50) {
+        CHECK(set.insert(var(chosen)).second == model.insert(chosen).second);
+      } else if (choice < 99) {
+        auto position = set.find(var(chosen));
+        CHECK((position != set.end()) == (model.count(chosen) == 1));
+        if (position != set.end()) {
+          set.erase(position);
+          model.erase(chosen);
+        }
+      } else {
+        set.clear();
+        model.clear();
+      }
+
+      CHECK(set.contains(var(chosen)) == (model.count(chosen) == 1));
+      if (step % 64 == 0) {
+        checkSame(set, model);
+      }
+    }
+    checkSame(set, model);
+  }
+
+  // Inserting and erasing one element over and over only leaves tombstones,
+  // which must not fill the table
+  void tombstonesAreReclaimed() {
+    FlatSet<var> set;
+    for (int32_t element = 0; element < 10000; ++element) {
+      set.insert(var(element));
+      set.erase(set.find(var(element)));
+    }
+    CHECK(set.empty());
+    CHECK(!set.contains(var(9999)));
+    CHECK(set.insert(var(5)).second);
+    CHECK(set.contains(var(5)));
+  }
+
+  void versionCountsChanges() {
+    FlatSet<var> set;
+    const std::size_t initial = set.version();
+    set.insert(var("a"));
+    const std::size_t inserted = set.version();
+    CHECK(inserted != initial);
+
+    // Already there, nothing changed
+    set.insert(var("a"));
+    CHECK(set.version() == inserted);
+
+    set.erase(set.find(var("a")));
+    CHECK(set.version() != inserted);
+    const std::size_t erased = set.version();
+    set.clear();
+    CHECK(set.version() != erased);
+  }
+
+  void mixedElements() {
+    FlatSet<var> set;
+    set.insert(var(1));
+    set.insert(var("1"));
+    set.insert(var(2.5));
+    set.insert(var(1));
+    CHECK(set.size() == 3);
+    CHECK(set.contains(var(1)));
+    CHECK(set.contains(var("1")));
+    CHECK(set.contains(var(2.5)));
+    CHECK(!set.contains(var(2)));
+  }
+}
+
+int main() {
+  churn(8, 5000);
+  churn(100, 20000);
+  churn(5000, 40000);
+  tombstonesAreReclaimed();
+  versionCountsChanges();
+  mixedElements();
+  return failures;
+}
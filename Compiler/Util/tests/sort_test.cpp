@@ -0,0 +1,195 @@
+// Copyright (c) 2024 Syntax Errors.
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "./check.hpp"
+#include "util.hpp"
+
+// Sorts give what std::stable_sort gives, for every layout and size that
+// takes a different path through SortKernels
+
+namespace {
+  // Lengths around the insertion sort, merge and radix thresholds
+  const std::size_t sizes[] = {0, 1, 2, 31, 32, 33, 100, 255, 256, 257, 1000, 5000};
+
+  std::mt19937 generator(46);
+
+  // Sorted copy of `numbers`, through Sequence::sort
+  template <typename T>
+  Sequence sortedOf(const std::vector<T>& numbers) {
+    Sequence sequence;
+    for (T number : numbers) {
+      sequence.push_back(var(number));
+    }
+    sequence.sort();
+    return sequence;
+  }
+
+  // Same doubles bit for bit, telling 0.0 from -0.0 and keeping NaN equal to itself
+  bool sameBits(std::span<const double> actual, const std::vector<double>& expected) {
+    return actual.size() == expected.size()
+        && (expected.empty() || std::memcmp(actual.data(), expected.data(), expected.size() * sizeof(double)) == 0);
+  }
+
+  void checkIntegers(std::vector<int32_t> numbers) {
+    const Sequence sequence = sortedOf(numbers);
+    std::stable_sort(numbers.begin(), numbers.end());
+    if (numbers.empty()) {
+      CHECK(sequence.empty());
+      return;
+    }
+    CHECK(sequence.layout() == Sequence::Layout::Integer);
+    CHECK(std::equal(sequence.integers().begin(), sequence.integers().end(), numbers.begin(), numbers.end()));
+  }
+
+  void checkReals(std::vector<double> numbers) {
+    const Sequence sequence = sortedOf(numbers);
+    std::stable_sort(numbers.begin(), numbers.end());
+    if (numbers.empty()) {
+      CHECK(sequence.empty());
+      return;
+    }
+    CHECK(sequence.layout() == Sequence::Layout::Double);
+    CHECK(sameBits(sequence.reals(), numbers));
+  }
+
+  void integers() {
+    std::uniform_int_distribution<int32_t> anything(std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max());
+    std::uniform_int_distribution<int32_t> few(-3, 3);
+    for (std::size_t size : sizes) {
+      std::vector<int32_t> random(size);
+      std::vector<int32_t> duplicates(size);
+      std::vector<int32_t> descending(size);
+      std::vector<int32_t> sawtooth(size);
+      for (std::size_t index = 0; index < size; ++index) {
+        random[index] = anything(generator);
+        duplicates[index] = few(generator);
+        descending[index] = static_cast<int32_t>(size - index) * 1000;
+        sawtooth[index] = static_cast<int32_t>(index % 40);
+      }
+      checkIntegers(random);
+      checkIntegers(duplicates);
+      checkIntegers(descending);
+      checkIntegers(sawtooth);
+    }
+
+    // Keys alike in all but one byte, so the radix sort skips the others
+    std::vector<int32_t> oneByte;
+    for (int32_t index = 0; index < 600; ++index) {
+      oneByte.push_back(0x12340000 + ((index * 37) & 0xFF00));
+    }
+    checkIntegers(oneByte);
+  }
+
+  void reals() {
+    std::uniform_real_distribution<double> anything(-1e6, 1e6);
+    std::uniform_int_distribution<int> few(-2, 2);
+    for (std::size_t size : sizes) {
+      std::vector<double> random(size);
+      std::vector<double> duplicates(size);
+      std::vector<double> descending(size);
+      for (std::size_t index = 0; index < size; ++index) {
+        random[index] = anything(generator);
+        // Zeros of both signs are equal, the sort must keep them in order
+        duplicates[index] = few(generator) == 0 ? (index % 2 ? -0.0 : 0.0) : few(generator) * 0.5;
+        descending[index] = static_cast<double>(size - index) / 4;
+      }
+      checkReals(random);
+      checkReals(duplicates);
+      checkReals(descending);
+    }
+  }
+
+  // NaN compares false either way, so where it ends up is up to the
+  // algorithm. Short inputs match CPython's sort exactly
+  void realsWithNaN() {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const std::vector<std::vector<double>> cases[] = {
+      {{3.0, nan, 1.0}, {3.0, nan, 1.0}},
+      {{nan, 2.0, 1.0}, {nan, 1.0, 2.0}},
+      {{3.0, nan, 1.0, 2.0, nan, 0.5}, {3.0, nan, 1.0, 2.0, nan, 0.5}},
+      {{5.0, 4.0, nan, 3.0, 2.0, 1.0}, {1.0, 2.0, 3.0, 4.0, 5.0, nan}},
+      {{2.0, 1.0, nan, 1.0, 2.0, 0.0, -1.0, nan}, {-1.0, 0.0, 1.0, 1.0, 2.0, nan, 2.0, nan}},
+    };
+    for (const auto& example : cases) {
+      const Sequence sequence = sortedOf(example[0]);
+      CHECK(sameBits(sequence.reals(), example[1]));
+    }
+
+    // Longer inputs keep every element, and the NaNs
+    std::uniform_real_distribution<double> anything(-100, 100);
+    for (std::size_t size : sizes) {
+      if (size == 0) {
+        continue;
+      }
+      std::vector<double> numbers(size);
+      for (std::size_t index = 0; index < size; ++index) {
+        numbers[index] = index % 7 == 3 ? nan : anything(generator);
+      }
+      const Sequence sequence = sortedOf(numbers);
+      std::vector<double> sorted(sequence.reals().begin(), sequence.reals().end());
+      auto byBits = [](double lhs, double rhs) {
+        return std::isnan(lhs) ? false : std::isnan(rhs) || lhs < rhs;
+      };
+      std::sort(numbers.begin(), numbers.end(), byBits);
+      std::sort(sorted.begin(), sorted.end(), byBits);
+      CHECK(sameBits(sorted, numbers));
+    }
+  }
+
+  // Elements with equal keys keep their order, through sorted(key=...)
+  void stableByKey() {
+    for (std::size_t size : sizes) {
+      if (size == 0) {
+        continue;
+      }
+      std::vector<int32_t> numbers(size);
+      for (std::size_t index = 0; index < size; ++index) {
+        numbers[index] = static_cast<int32_t>(index);
+      }
+      std::shuffle(numbers.begin(), numbers.end(), generator);
+
+      var list = Builtin::inlineList({});
+      for (int32_t number : numbers) {
+        list.Call(Methods::append, {var(number).getValue()});
+      }
+      var result = Builtin::sorted(list, [](const var& element) {
+        return var(std::stoi(printed(element)) % 7);
+      });
+
+      std::stable_sort(numbers.begin(), numbers.end(), [](int32_t lhs, int32_t rhs) { return lhs % 7 < rhs % 7; });
+      const Sequence& sorted = objectCast<List>(result.getValue())->getValue();
+      CHECK(std::equal(sorted.integers().begin(), sorted.integers().end(), numbers.begin(), numbers.end()));
+    }
+
+    // Strings, keyed by length
+    var words = Builtin::inlineList({var("pear"), var("fig"), var("apple"), var("kiwi"), var("plum"), var("date")});
+    var byLength = Builtin::sorted(words, [](const var& element) { return Builtin::len({element.getValue()}); });
+    CHECK(printed(byLength) == "[fig, pear, kiwi, plum, date, apple]");
+  }
+
+  void mixedLayouts() {
+    var list = Builtin::inlineList({var(3), var(1.5), var(2), var(-1), var(0.0)});
+    list.Call(Methods::sort, {});
+    CHECK(printed(list) == printed(Builtin::inlineList({var(-1), var(0.0), var(1.5), var(2), var(3)})));
+
+    var words = Builtin::inlineList({var("b"), var("a"), var("c"), var("a")});
+    CHECK(printed(Builtin::sorted(words)) == "[a, a, b, c]");
+  }
+}
+
+int main() {
+  integers();
+  reals();
+  realsWithNaN();
+  stableByKey();
+  mixedLayouts();
+  return failures;
+}
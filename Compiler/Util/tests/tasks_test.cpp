@@ -0,0 +1,112 @@
+// Copyright (c) 2024 Syntax Errors.
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "./check.hpp"
+#include "util.hpp"
+
+// Sorts, reductions and searches split across the thread pool give the same
+// results whatever the number of threads. Settings are read from the
+// environment once per process, so the test runs itself again once per
+// setting and compares what each run printed
+
+namespace {
+  // Several chunks of the reductions, far over the cutoff the runs are given
+  constexpr std::size_t size = 300000;
+
+  // Digest of the results, enough to tell any difference apart
+  std::string digest() {
+    std::mt19937 generator(24);
+    std::uniform_int_distribution<int32_t> integer(-1000000, 1000000);
+    std::uniform_real_distribution<double> real(-1e3, 1e3);
+
+    std::vector<int32_t> integers(size);
+    std::vector<double> reals(size);
+    Sequence integerSequence;
+    Sequence realSequence;
+    for (std::size_t index = 0; index < size; ++index) {
+      integers[index] = integer(generator);
+      // Zeros of both signs tell a stable merge from an unstable one
+      reals[index] = index % 101 == 0 ? (index % 2 ? -0.0 : 0.0) : real(generator);
+      integerSequence.push_back(var(integers[index]));
+      realSequence.push_back(var(reals[index]));
+    }
+
+    std::ostringstream os;
+    os << std::hexfloat;
+
+    auto realOf = [](const var& number) { return objectCast<Double>(number.getValue())->getValue(); };
+    os << realOf(realSequence.sum()) << " " << realOf(realSequence.min()) << " " << realOf(realSequence.max()) << "\n";
+    os << integerSequence.sum() << " " << integerSequence.min() << " " << integerSequence.max() << "\n";
+
+    // Late and repeated matches, so chunks past the first match are skipped
+    for (std::size_t position : {std::size_t(5), size / 2, size - 3}) {
+      CHECK(integerSequence.find(var(integers[position])) <= position);
+      os << integerSequence.find(var(integers[position])) << " " << realSequence.find(var(reals[position])) << "\n";
+    }
+    os << integerSequence.find(var(2000000)) << "\n";
+
+    integerSequence.sort();
+    realSequence.sort();
+    std::stable_sort(integers.begin(), integers.end());
+    std::stable_sort(reals.begin(), reals.end());
+
+    const Sequence& sortedIntegers = integerSequence;
+    const Sequence& sortedReals = realSequence;
+    CHECK(std::equal(sortedIntegers.integers().begin(), sortedIntegers.integers().end(), integers.begin(), integers.end()));
+    CHECK(std::equal(sortedReals.reals().begin(), sortedReals.reals().end(), reals.begin(), reals.end(),
+        [](double lhs, double rhs) { return std::signbit(lhs) == std::signbit(rhs) && lhs == rhs; }));
+
+    // Checksum of the sorted buffers, bit for bit
+    uint64_t checksum = 1469598103934665603ULL;
+    for (int32_t number : sortedIntegers.integers()) {
+      checksum = (checksum ^ static_cast<uint32_t>(number)) * 1099511628211ULL;
+    }
+    for (double number : sortedReals.reals()) {
+      uint64_t bits;
+      std::memcpy(&bits, &number, sizeof(bits));
+      checksum = (checksum ^ bits) * 1099511628211ULL;
+    }
+    os << checksum << "\n";
+
+    return os.str();
+  }
+
+  // Output of this test run with `--digest` under `settings`, empty if it failed
+  std::string digestUnder(const std::string& program, const std::string& settings) {
+    const std::string command = settings + " '" + program + "' --digest";
+    FILE* pipe = popen(command.c_str(), "r");
+    if (!pipe) {
+      return "";
+    }
+
+    std::string output;
+    char buffer[256];
+    while (std::size_t read = std::fread(buffer, 1, sizeof(buffer), pipe)) {
+      output.append(buffer, read);
+    }
+    return pclose(pipe) == 0 ? output : "";
+  }
+}
+
+int main(int argc, char* argv[]) {
+  if (argc > 1 && std::string(argv[1]) == "--digest") {
+    std::cout << digest();
+    return failures;
+  }
+
+  const std::string serial = digestUnder(argv[0], "SE_THREADS=1");
+  CHECK(!serial.empty());
+  for (const char* threads : {"2", "3", "8"}) {
+    CHECK(digestUnder(argv[0], std::string("SE_THREADS=") + threads + " SE_PARALLEL_CUTOFF=1024") == serial);
+  }
+  return failures;
+}
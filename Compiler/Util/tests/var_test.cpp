@@ -0,0 +1,135 @@
+// Copyright (c) 2024 Syntax Errors.
+#include "./check.hpp"
+#include "util.hpp"
+
+// Vars share objects until one of them changes (copy-on-write), and a change
+// made through a container element never shows up in another variable
+
+namespace {
+  void appendTo(var& target, const var& element) {
+    target.Call(Methods::append, {element.getValue()});
+  }
+
+  void copiesAreIndependent() {
+    var original = Builtin::inlineList({var(1), var(2)});
+    var copy = original;
+    appendTo(copy, var(3));
+    CHECK(printed(original) == "[1, 2]");
+    CHECK(printed(copy) == "[1, 2, 3]");
+  }
+
+  void loopVariablesAreCopies() {
+    var inner = Builtin::inlineList({var("x"), var("y")});
+    var outer = Builtin::inlineList({});
+    appendTo(outer, inner);
+    for (auto element : outer) {
+      appendTo(element, var("q"));
+    }
+    CHECK(printed(inner) == "[x, y]");
+    CHECK(printed(outer) == "[[x, y]]");
+  }
+
+  void subscriptChangesOnlyTheSlot() {
+    var inner = Builtin::inlineList({var("x"), var("y")});
+    var outer = Builtin::inlineList({});
+    appendTo(outer, inner);
+    outer[var(0)].Call(Methods::append, {var("q").getValue()});
+    CHECK(printed(inner) == "[x, y]");
+    CHECK(printed(outer) == "[[x, y, q]]");
+
+    // Again, now that the slot holds an object of its own
+    outer[var(-1)].Call(Methods::append, {var("r").getValue()});
+    CHECK(printed(outer) == "[[x, y, q, r]]");
+  }
+
+  void subscriptOfSetElement() {
+    var set = Builtin::inlineSet({var(1)});
+    var outer = Builtin::inlineList({});
+    appendTo(outer, set);
+    for (int32_t value = 2; value < 800; ++value) {
+      outer[var(0)].Call(Methods::add, {var(value).getValue()});
+    }
+    CHECK(Builtin::len({set}) == var(1));
+    CHECK(Builtin::len({var(outer[var(0)])}) == var(799));
+  }
+
+  void subscriptOfSharedContainer() {
+    var outer = Builtin::inlineList({});
+    appendTo(outer, Builtin::inlineList({var(1)}));
+    var copy = outer;
+    outer[var(0)].Call(Methods::append, {var(2).getValue()});
+    CHECK(printed(copy) == "[[1]]");
+    CHECK(printed(outer) == "[[1, 2]]");
+  }
+
+  void subscriptOfDictValue() {
+    var dict = Builtin::inlineDict({Pair(var("k"), var(Builtin::inlineList({})))});
+    var copy = dict;
+    dict[var("k")].Call(Methods::append, {var(1).getValue()});
+    CHECK(printed(dict) == "{k: [1]}");
+    CHECK(printed(copy) == "{k: []}");
+  }
+
+  void subscriptOfNestedElement() {
+    var outer = Builtin::inlineList({});
+    appendTo(outer, Builtin::inlineList({var(0), Builtin::inlineList({})}));
+    var copy = outer;
+    outer[var(0)][var(1)].Call(Methods::append, {var(2).getValue()});
+    CHECK(printed(outer) == "[[0, [2]]]");
+    CHECK(printed(copy) == "[[0, []]]");
+  }
+
+  // Only a subscript reaches the stored element, values read out of a
+  // container are copies like any other
+  void readElementsAreCopies() {
+    var outer = Builtin::inlineList({});
+    appendTo(outer, Builtin::inlineList({var(1)}));
+    var element = outer[var(0)];
+    for (int32_t value = 0; value < 100; ++value) {
+      appendTo(outer, var(value));
+    }
+    appendTo(element, var(2));
+    CHECK(printed(element) == "[1, 2]");
+    CHECK(printed(outer[var(0)].get()) == "[1]");
+
+    var dict = Builtin::inlineDict({Pair(var("k"), var(Builtin::inlineList({})))});
+    var first = dict.Call(Methods::get, {var("k").getValue()});
+    var second = dict.Call(Methods::get, {var("k").getValue()});
+    appendTo(second, var(9));
+    appendTo(first, var(8));
+    CHECK(printed(first) == "[8]");
+    CHECK(printed(second) == "[9]");
+    CHECK(printed(dict) == "{k: []}");
+  }
+
+  // Slices share their list's storage, which neither the list, its copies
+  // nor the slices see
+  void slicesAreIndependent() {
+    var outer = Builtin::inlineList({});
+    for (int32_t value = 0; value < 40; ++value) {
+      appendTo(outer, Builtin::inlineList({var(value)}));
+    }
+    var copy = outer;
+    var slice = outer.Call(Methods::slice, {var(0).getValue(), var(20).getValue()});
+    outer[var(0)].Call(Methods::append, {var(-1).getValue()});
+    appendTo(slice, var(7));
+    CHECK(printed(outer[var(0)].get()) == "[0, -1]");
+    CHECK(printed(copy[var(0)].get()) == "[0]");
+    CHECK(printed(slice[var(0)].get()) == "[0]");
+    CHECK(Builtin::len({outer}) == var(40));
+    CHECK(Builtin::len({slice}) == var(21));
+  }
+}
+
+int main() {
+  copiesAreIndependent();
+  loopVariablesAreCopies();
+  subscriptChangesOnlyTheSlot();
+  subscriptOfSetElement();
+  subscriptOfSharedContainer();
+  subscriptOfDictValue();
+  subscriptOfNestedElement();
+  readElementsAreCopies();
+  slicesAreIndependent();
+  return failures;
+}